@@ -0,0 +1,38 @@
+// Per-host circuit breaker for the status server and stock quote requests
+//
+// Every route on a host fails together when the host is down, so failures are
+// tracked per host rather than per URL. After BREAKER_FAILURE_THRESHOLD
+// consecutive failures the circuit opens and requests to that host fail
+// immediately, without DNS, connect or airtime. Once the open period ends the
+// circuit is half-open: a single request goes through as a probe, closing the
+// circuit on success or reopening it for twice as long (with jitter, up to
+// BREAKER_OPEN_MAX) on failure. Timeouts, connection errors, 5xx and 429
+// count as failures; any other HTTP answer proves the host is up.
+//
+// Not thread safe: only the fetch worker task may use the breakers.
+
+#ifndef CIRCUIT_BREAKER_H
+#define CIRCUIT_BREAKER_H
+
+#include <Arduino.h>
+
+const int BREAKER_COUNT = 4;                           // Status server + stock host + spares
+const int BREAKER_FAILURE_THRESHOLD = 3;               // Consecutive failures that open the circuit
+const unsigned long BREAKER_OPEN_MIN = 15000;          // First open period
+const unsigned long BREAKER_OPEN_MAX = 600000;         // Open period cap (10 minutes)
+const unsigned long BREAKER_PROBE_TIMEOUT = 30000;     // Allow another probe if one never reported back
+
+// May a request to host go out now? False while the circuit is open.
+bool breakerAllow(const char *host);
+
+// Report the outcome of a request that breakerAllow() let through.
+// httpCode is an HTTP status or a negative HTTPC_ERROR_* code.
+void breakerRecord(const char *host, int httpCode);
+
+// Move every open circuit to half-open, e.g. for a manual refresh.
+void breakerProbeNow();
+
+// Print each host's circuit state and failure counters to Serial.
+void breakerPrintStats();
+
+#endif
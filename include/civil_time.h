@@ -0,0 +1,52 @@
+// Local civil time from the UTC clock
+//
+// The time zone is a POSIX TZ string such as "EST5EDT,M3.2.0,M11.1.0" (US
+// Eastern: UTC-5, daylight time from the second Sunday in March to the first
+// Sunday in November, switching at 02:00 local). The C library applies the
+// rule, so the date, weekday and daylight saving offset are exact for any
+// year, including the transition weeks, with no server round trip.
+//
+// Everything but civilFormatDate() also builds on the host, for the unit
+// tests in test/test_civil_time (pio test -e native).
+//
+// civilTimeBegin() must run before the other functions; after that they may
+// be called from any task.
+
+#ifndef CIVIL_TIME_H
+#define CIVIL_TIME_H
+
+#include <time.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+struct CivilTime {
+    int year;
+    int month;      // 1-12
+    int day;        // 1-31
+    int weekday;    // 0 = Sunday
+    int hour;
+    int minute;
+    int second;
+    bool dst;       // Daylight saving time in effect
+    long utcOffset; // Seconds east of UTC, DST included
+};
+
+// Set the zone rule used by every conversion.
+void civilTimeBegin(const char *posixTz);
+
+// Convert a UTC epoch (seconds since 1970) to local time.
+CivilTime civilTimeFromUtc(time_t utc);
+
+// Days from 1970-01-01 to the given proleptic Gregorian date.
+long civilDayNumber(int year, int month, int day);
+
+#ifdef ARDUINO
+// "Friday, October 16"
+String civilFormatDate(const CivilTime &time);
+#endif
+
+// Zone abbreviation in effect, e.g. "EST" or "EDT".
+const char *civilZoneName(const CivilTime &time);
+
+#endif
@@ -0,0 +1,41 @@
+// Host name cache for the status server and printers
+//
+// mDNS lookups of mainPI.local and the printer hosts can take hundreds of ms,
+// or time out when the Pi is slow to answer. Resolved addresses are kept for
+// DNS_CACHE_TTL and re-resolved from the fetch worker's idle pass before they
+// expire, so a poll only blocks on a lookup the first time a host is seen.
+// Failed lookups are remembered for DNS_NEGATIVE_TTL so an unreachable
+// printer does not stall every poll. If a refresh fails the last good address
+// keeps being served until a connect to it fails.
+//
+// Not thread safe: only the fetch worker task may use the cache.
+
+#ifndef DNS_CACHE_H
+#define DNS_CACHE_H
+
+#include <WiFi.h>
+
+const int DNS_CACHE_SIZE = 6;                          // Status server + printers + spares
+const unsigned long DNS_CACHE_TTL = 600000;            // lwIP does not expose record TTLs; keep addresses 10 minutes
+const unsigned long DNS_NEGATIVE_TTL = 30000;          // Retry a failed lookup after 30 seconds
+const unsigned long DNS_REFRESH_AHEAD = 60000;         // Re-resolve in the background 1 minute before expiry
+
+// Look up host, using the cache when possible. Blocks only for a host that
+// has never been resolved. Returns false if the host is known not to resolve.
+bool dnsCacheResolve(const char *host, IPAddress &ip);
+
+// Like dnsCacheResolve(), but a host whose last lookup failed is not looked up
+// again here: it stays unresolved until dnsCacheRefresh() retries it. For poll
+// paths that must not block on a host that is known to be down.
+bool dnsCacheResolveCached(const char *host, IPAddress &ip);
+
+// Drop the cached address, e.g. after a connect to it failed (DHCP lease moved).
+void dnsCacheInvalidate(const char *host);
+
+// Re-resolve at most one entry that is close to expiry. Call when the worker is idle.
+void dnsCacheRefresh();
+
+// Print hit/miss counters and cached addresses to Serial.
+void dnsCachePrintStats();
+
+#endif
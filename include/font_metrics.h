@@ -0,0 +1,30 @@
+// Cached text widths of the built-in fonts
+//
+// TFT_eSPI measures a string by reading the font's width table from flash for
+// every character on every call. The widths of the bitmap fonts this display
+// uses (1, 2 and 4) at text size 1 are copied into RAM once at boot, so
+// centring, diffing and layout measure text with a table lookup per byte.
+// Text is measured the way drawString() advances the cursor, not the way
+// textWidth() counts bytes: UTF-8 is decoded first, and a character outside
+// printable ASCII (the "°" in the weather lines, say) takes no room in fonts 2
+// and 4 and a full 6 px cell in font 1.
+//
+// Not thread safe: fontMetricsBegin() once from setup(), the rest from loop().
+
+#ifndef FONT_METRICS_H
+#define FONT_METRICS_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Measure fonts 1, 2 and 4 through tft.
+void fontMetricsBegin(TFT_eSPI &tft);
+
+// Width at text size 1 of bytes from..to (to < 0: the end) of text in font,
+// as drawn; from must start a UTF-8 sequence. 0 for fonts that are not cached.
+int fontTextWidth(const String &text, uint8_t font, int from = 0, int to = -1);
+
+// Line height at text size 1 of font; 0 for fonts that are not cached.
+int fontLineHeight(uint8_t font);
+
+#endif
@@ -0,0 +1,43 @@
+// Pre-rendered clock glyphs
+//
+// The digits 0-9 and ':' of one built-in font at one text size are rendered
+// once into 1-bit masks. Drawing a time string then only turns each mask row
+// into horizontal runs on the target, instead of TFT_eSPI decoding and
+// scaling the font's RLE data pixel by pixel for every character. The masks do
+// not depend on the rotation: the panel's address mode rotates whatever is
+// pushed. The built-in fonts give all digits one width, so a character's cell
+// depends only on its position in a fixed-format string like "HH:MM".
+//
+// Not thread safe: build and draw from loop() only.
+
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+const char GLYPH_ATLAS_CHARS[] = "0123456789:";
+const int GLYPH_ATLAS_COUNT = sizeof(GLYPH_ATLAS_CHARS) - 1;
+
+struct GlyphAtlas {
+    int16_t height;
+    int16_t widths[GLYPH_ATLAS_COUNT];
+    uint16_t offsets[GLYPH_ATLAS_COUNT];   // Start of each mask in bytes, rows padded to whole bytes
+    uint8_t *bits;                         // NULL until built
+};
+
+// Render the glyphs of font at text size through a temporary 1-bit sprite of
+// parent. Returns false (and leaves the atlas unusable) when out of memory.
+bool glyphAtlasBuild(GlyphAtlas &atlas, TFT_eSPI &parent, uint8_t font, uint8_t size);
+
+// Every character of text has a glyph in the atlas.
+bool glyphAtlasCovers(const GlyphAtlas &atlas, const String &text);
+
+// Width of the first count characters of text (all of it when count < 0).
+int glyphAtlasTextWidth(const GlyphAtlas &atlas, const String &text, int count = -1);
+
+// Draw text with its top left at (x, y) in color, leaving the background as it
+// is. Returns the width drawn. The text must be covered by the atlas.
+int glyphAtlasDraw(const GlyphAtlas &atlas, TFT_eSPI &out, const String &text, int x, int y, uint16_t color);
+
+#endif
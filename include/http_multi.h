@@ -0,0 +1,39 @@
+// Parallel HTTP GETs on non-blocking lwIP sockets
+//
+// httpMultiGet() opens one socket per request, drives every connect, send and
+// receive from a single select() loop and gives all requests one shared
+// deadline. A poll of N hosts therefore takes as long as the slowest host (or
+// the timeout), not the sum of N timeouts, so an offline printer no longer
+// delays the others. Requests are HTTP/1.0 with the connection closed by the
+// server, which keeps the response framing trivial (no chunked bodies).
+// Addresses come from the DNS cache. A host whose lookup failed is skipped
+// until the worker's idle pass resolves it again, so no poll waits on a lookup
+// before its connects start.
+//
+// Not thread safe: only the fetch worker task may call it.
+
+#ifndef HTTP_MULTI_H
+#define HTTP_MULTI_H
+
+#include <WiFi.h>
+#include <HTTPClient.h>
+
+const int HTTP_MULTI_MAX_REQUESTS = 8;      // Sockets open at once
+const size_t HTTP_MULTI_MAX_RESPONSE = 4096; // Headers + body; larger responses fail with HTTPC_ERROR_TOO_LESS_RAM
+
+struct HttpMultiRequest {
+    // Filled in by the caller
+    String host;
+    uint16_t port;
+    String path;
+
+    // Filled in by httpMultiGet()
+    int status;             // HTTP status code, or a negative HTTPC_ERROR_* code
+    String body;
+    unsigned long elapsed;  // ms from start until this request finished or gave up
+};
+
+// Run up to HTTP_MULTI_MAX_REQUESTS GETs concurrently, all finishing within timeoutMs.
+void httpMultiGet(HttpMultiRequest *requests, int count, unsigned long timeoutMs);
+
+#endif
@@ -0,0 +1,106 @@
+// Keep-alive HTTP/1.1 connection pool shared by all fetch functions,
+// plus helpers to parse response bodies straight from the socket
+//
+// Each slot keeps one WiFiClient/HTTPClient pair bound to a host:port, so
+// back-to-back requests to the status server (or a printer) reuse the open
+// TCP socket instead of resolving the host and handshaking every time. New
+// sockets are opened to the address from the DNS cache (dns_cache.h), so
+// HTTPClient never runs a name lookup itself.
+// Idle sockets are closed after HTTP_POOL_IDLE_TIMEOUT and a socket the
+// server closed behind our back is reopened transparently on the next GET.
+//
+// GET requests also carry If-None-Match / If-Modified-Since from a small
+// per-endpoint validator cache, so unchanged data comes back as a bodyless 304.
+//
+// Not thread safe: only the fetch worker task may use the pool.
+
+#ifndef HTTP_POOL_H
+#define HTTP_POOL_H
+
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+
+const int HTTP_POOL_SIZE = 2;                          // Status server + spare
+const unsigned long HTTP_POOL_IDLE_TIMEOUT = 60000;    // Close sockets unused for 60 seconds
+const uint16_t HTTP_POOL_DEFAULT_TIMEOUT = 5000;       // Same as the HTTPClient default
+const int HTTP_VALIDATOR_CACHE_SIZE = 8;               // Endpoints remembered for conditional GETs
+
+struct PooledConnection {
+    WiFiClient client;
+    HTTPClient http;
+    String host;             // Empty when the slot is not bound to a server
+    uint16_t port;
+    String path;             // Path of the current request, keys the validator cache
+    uint16_t timeoutMs;      // Connect/response timeout of the current request
+    bool inUse;
+    unsigned long lastUsed;  // millis() when the slot was last released
+};
+
+// Get a connection to host:port prepared for a request to path.
+// Returns NULL if every slot is busy.
+PooledConnection *httpPoolAcquire(const char *host, uint16_t port, const String &path,
+                                  uint16_t timeoutMs = HTTP_POOL_DEFAULT_TIMEOUT);
+
+// Send the request. A GET or HEAD whose reused socket turned out to be dead before the
+// request went out is retried once on a fresh socket; nothing else is ever sent twice.
+// GETs to an endpoint with cached validators are sent conditionally and may return
+// HTTP_CODE_NOT_MODIFIED. While the host's circuit breaker is open the request is not
+// sent at all. Returns the HTTP status code or a negative HTTPC_ERROR_* code.
+int httpPoolSend(PooledConnection *conn, const char *method, const String &body = "");
+
+// Remember the ETag / Last-Modified of a 200 response for the next conditional GET.
+// Call only after the body was parsed and applied, so a 304 never stands in for data we lost.
+void httpPoolCacheValidators(PooledConnection *conn);
+
+// Forget every cached validator; the next GET to each endpoint returns a full body.
+void httpPoolClearValidators();
+
+// Give the connection back once the response has been read.
+void httpPoolRelease(PooledConnection *conn);
+
+// Close sockets that have been idle for longer than HTTP_POOL_IDLE_TIMEOUT.
+void httpPoolEvictIdle();
+
+// Print request/reuse counters to Serial.
+void httpPoolPrintStats();
+
+// Response body as a Stream: stops at the end of the body and decodes
+// chunked transfer encoding, so nothing past the response is consumed.
+class HttpBodyStream : public Stream {
+public:
+    HttpBodyStream(HTTPClient &http, unsigned long timeoutMs = HTTP_POOL_DEFAULT_TIMEOUT);
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t write(uint8_t) override { return 0; }
+
+    // Read and discard the rest of the body. Returns false if the socket
+    // cannot be reused (body length unknown, timeout or broken framing).
+    bool drain();
+
+private:
+    bool nextChunk();
+    int waitByte();
+
+    WiFiClient &client;
+    bool chunked;
+    long remaining;      // Bytes left in the body or current chunk; -1 = read until close
+    bool chunkStarted;   // A chunk has been read, so its trailing CRLF is still pending
+    bool finished;
+    bool broken;
+    unsigned long timeoutMs;
+};
+
+// Ask HTTPClient to keep the response headers HttpBodyStream and the validator
+// cache need. Call before every request: HTTPClient only overwrites headers the
+// new response carries, so a reused client would otherwise still report the
+// previous response's Transfer-Encoding, ETag or Last-Modified.
+void httpCollectResponseHeaders(HTTPClient &http);
+
+// Deserialize the response body into doc, keeping only the fields in filter,
+// then drain the body so a keep-alive socket is clean for the next request.
+DeserializationError httpParseJsonBody(HTTPClient &http, JsonDocument &doc, JsonDocument &filter);
+
+#endif
@@ -0,0 +1,64 @@
+// Icon set kept in flash
+//
+// Weather icons and the small status glyphs of the trail, coffee and printer
+// widgets are generated by tools/icon_pack.py into a palette-indexed,
+// run-length encoded pack of about 2KB in flash. Drawing one decodes it into
+// a RAM buffer and sends it with a single pushImage(), so an icon is one block
+// transfer (or one sprite copy) instead of a string compare chain followed by
+// circles and lines drawn primitive by primitive. The icons are opaque: every
+// pixel of the cell is written, in the given background where the icon is
+// empty, so nothing needs clearing first. Status glyphs are drawn in a tint
+// colour given by the caller. Weather codes are turned into an IconId once,
+// when the data arrives.
+//
+// Not thread safe: draw from loop() only. iconFromWeatherCode() may be called
+// from any task.
+
+#ifndef ICON_PACK_H
+#define ICON_PACK_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// In pack order (see tools/icon_pack.py); ICON_NONE draws nothing
+enum IconId : uint8_t {
+    ICON_NONE,
+    ICON_CLEAR_DAY,
+    ICON_CLEAR_NIGHT,
+    ICON_FEW_CLOUDS_DAY,
+    ICON_FEW_CLOUDS_NIGHT,
+    ICON_CLOUDS,           // Scattered or broken, day and night
+    ICON_RAIN,
+    ICON_THUNDERSTORM,
+    ICON_SNOW,
+    ICON_MIST,
+    ICON_STATUS_FULL,      // 11x11 dots for a font 2 line
+    ICON_STATUS_HALF,
+    ICON_STATUS_EMPTY,
+    ICON_PRINTER,          // 14x14 printer status dot
+    ICON_COUNT
+};
+
+const int ICON_STATUS_SIZE = 11;
+
+// Icon for an OpenWeatherMap code such as "10n"; ICON_NONE when unknown.
+IconId iconFromWeatherCode(const String &code);
+
+// Size of icon in pixels; 0 for ICON_NONE.
+int iconWidth(IconId icon);
+int iconHeight(IconId icon);
+
+// Draw icon with its top left at (x, y) in one pushImage(). tint colours the
+// status glyphs and the printer dot; background fills the empty pixels. The
+// sprite overload also handles the 8-bit canvas fallback.
+void iconDraw(TFT_eSPI &out, IconId icon, int x, int y, uint16_t tint, uint16_t background);
+void iconDraw(TFT_eSprite &out, IconId icon, int x, int y, uint16_t tint, uint16_t background);
+
+// Draw a status dot into the top left of canvas and read it back: true when the
+// sprite's buffer, not the panel, received the pixels. Overwrites that corner.
+bool iconPackSelfTest(TFT_eSprite &canvas);
+
+// Print draw counts and the pack size to Serial.
+void iconPackPrintStats();
+
+#endif
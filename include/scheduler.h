@@ -0,0 +1,47 @@
+// Deadline-driven job scheduler for the fetch worker
+//
+// Jobs sit in a binary min-heap keyed by their next deadline, so the worker
+// finds what is due, and how long it may sleep, without scanning every job.
+// Each job has a run interval, a random jitter added to every deadline (keeps
+// jobs with equal intervals from firing in the same pass), a retry delay used
+// after a failed run, doubled for every further failure up to the job's
+// interval, and a priority that orders jobs falling due together.
+// schedulerRunDue() runs at most `budget` jobs per call; the rest stay due and
+// run on the next call, after the worker has serviced requests in between.
+//
+// Not thread safe: only the fetch worker task may use the scheduler.
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+const int SCHEDULER_MAX_JOBS = 12;
+const int SCHEDULER_MAX_DOUBLINGS = 10;  // Retry backoff stops growing after this many failures
+
+// Run one job. arg is whatever was passed to schedulerRunDue(). Return false to
+// be retried after the job's (backed off) retry delay instead of its interval.
+typedef bool (*SchedulerJobFunction)(void *arg);
+
+// Register a job, due immediately. Returns its id, or -1 when the table is full.
+int schedulerAddJob(const char *name, SchedulerJobFunction run, unsigned long interval,
+                    unsigned long jitter, unsigned long retryDelay, uint8_t priority);
+
+// Run up to budget due jobs, highest priority first, and reschedule each one.
+// Returns the number of jobs run.
+int schedulerRunDue(unsigned long now, int budget, void *arg);
+
+// Reschedule a job that was run outside schedulerRunDue() (or whose data
+// arrived another way) as if it had just run.
+void schedulerComplete(int job, bool success, unsigned long now);
+
+// Make a job due now, e.g. when its data source just became stale.
+void schedulerExpedite(int job, unsigned long now);
+
+// ms until the earliest deadline; 0 when a job is due, ULONG_MAX with no jobs.
+unsigned long schedulerTimeUntilNext(unsigned long now);
+
+// Print per-job run counts, failures, lateness and next deadline to Serial.
+void schedulerPrintStats();
+
+#endif
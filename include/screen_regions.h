@@ -0,0 +1,61 @@
+// Dirty-rectangle redraw manager for the main screen
+//
+// Every widget is registered with its bounding box for the current rotation
+// and a function that repaints the whole box. Widgets are identified by their
+// id, which is also their z-order: a higher id is painted later, on top.
+// Changes only mark rectangles dirty; overlapping dirty rectangles are merged
+// into their bounding box. regionFlush() repaints, lowest id first, every
+// widget that intersects a dirty rectangle, and adds the box of each widget it
+// repaints to the dirty set, so a widget overlapping one that was just painted
+// is painted again on top of it. Widgets therefore never need to know their
+// neighbours or redraw them after clearing their own area. A repaint only has
+// to reach the panel inside regionDamage(), the dirty part of the widget, so
+// marking a few changed characters dirty sends just those to the panel.
+//
+// Not thread safe: only loop() may use the region manager.
+
+#ifndef SCREEN_REGIONS_H
+#define SCREEN_REGIONS_H
+
+#include <Arduino.h>
+
+const int REGION_MAX_WIDGETS = 16;
+const int REGION_MAX_DIRTY = 8;          // Further rectangles are merged into the last one
+
+struct ScreenRect {
+    int16_t x, y, w, h;
+};
+
+// Repaint the widget's whole bounding box.
+typedef void (*RegionDrawFunction)();
+
+// The overlap of two rectangles (empty when they do not meet).
+ScreenRect regionIntersection(const ScreenRect &a, const ScreenRect &b);
+
+// Register or move widget id (0..REGION_MAX_WIDGETS-1, also its z-order).
+void regionSetWidget(int id, const ScreenRect &bounds, RegionDrawFunction draw);
+
+// The widget's bounding box for the current rotation.
+const ScreenRect &regionBounds(int id);
+
+// Mark a widget's bounding box, or any rectangle, as needing a repaint.
+void regionInvalidate(int id);
+void regionInvalidateRect(const ScreenRect &rect);
+
+// Mark every widget as needing a repaint, e.g. after the screen was cleared.
+void regionInvalidateAll();
+
+// Some rectangle is waiting for regionFlush().
+bool regionPending();
+
+// Inside a draw function: the dirty part of the widget being repainted. Only
+// this part of the panel has to be written; the rest already shows the widget.
+const ScreenRect &regionDamage();
+
+// Repaint the widgets touching dirty rectangles. Returns the number painted.
+int regionFlush();
+
+// Print flush, repaint and merge counts and pixels pushed to Serial.
+void regionsPrintStats();
+
+#endif
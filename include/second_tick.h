@@ -0,0 +1,32 @@
+// Seconds ticks aligned to the wall clock
+//
+// A one-shot esp_timer is armed for the next whole second of the system clock
+// and re-armed from gettimeofday() every time it fires, so ticks follow the
+// SNTP-slewed clock instead of accumulating loop() latency. Each tick posts
+// the second it stands for and wakes the task given to secondTickBegin(). A
+// tick still pending when the next one fires is replaced and counted as
+// missed; one taken more than SECOND_TICK_LATE_US after its boundary is
+// counted as late.
+//
+// Not thread safe: only the task given to secondTickBegin() may take ticks.
+
+#ifndef SECOND_TICK_H
+#define SECOND_TICK_H
+
+#include <Arduino.h>
+#include <time.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+const long SECOND_TICK_LATE_US = 10000;                // Digits should start updating within 10ms of the boundary
+
+// Start ticking; each tick notifies (xTaskNotifyGive) the given task.
+void secondTickBegin(TaskHandle_t notify);
+
+// Take the pending tick, if any, recording how late it was taken.
+bool secondTickTake(time_t &second);
+
+// Print tick, late and missed counts and lateness to Serial, then reset them.
+void secondTickPrintStats();
+
+#endif
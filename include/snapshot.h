@@ -0,0 +1,78 @@
+// Last-known widget state in NVS, for an instant warm boot
+//
+// main.cpp encodes its widget structs with SnapshotWriter and decodes them
+// with SnapshotReader: a version byte, then fixed size numbers and strings
+// with a one byte length prefix, so a full snapshot is a few hundred bytes.
+// NVS checksums each blob and spreads writes over its pages. On top of that
+// snapshotSave() skips the write when the bytes match what is stored, and
+// callers wait for snapshotDue() so the flash sees at most one write every
+// SNAPSHOT_MIN_INTERVAL however often the data changes.
+//
+// Not thread safe: only loop() may use the snapshot.
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <Arduino.h>
+
+const uint8_t SNAPSHOT_VERSION = 3;                    // Bump when the encoding in main.cpp changes
+const size_t SNAPSHOT_MAX_SIZE = 512;                  // Encoded widget state
+const unsigned long SNAPSHOT_MIN_INTERVAL = 900000;    // At most one flash write per 15 minutes
+
+class SnapshotWriter {
+public:
+    SnapshotWriter();
+
+    void writeByte(uint8_t value);
+    void writeInt16(int16_t value);
+    void writeFloat(float value);
+    void writeString(const String &value);  // Truncated to 255 bytes
+
+    // A write ran past SNAPSHOT_MAX_SIZE; the snapshot must not be stored.
+    bool overflowed() const;
+    const uint8_t *data() const;
+    size_t length() const;
+
+private:
+    void write(const void *bytes, size_t count);
+
+    uint8_t buffer[SNAPSHOT_MAX_SIZE];
+    size_t used;
+    bool overflow;
+};
+
+class SnapshotReader {
+public:
+    SnapshotReader(const uint8_t *bytes, size_t count);
+
+    uint8_t readByte();
+    int16_t readInt16();
+    float readFloat();
+    String readString();
+
+    // Every read so far was within the data.
+    bool ok() const;
+
+private:
+    bool read(void *bytes, size_t count);
+
+    const uint8_t *data;
+    size_t length;
+    size_t position;
+    bool valid;
+};
+
+// Read the stored snapshot into buffer. Returns the number of bytes after the
+// version byte, or 0 when there is none or it was written by another version.
+size_t snapshotLoad(uint8_t *buffer, size_t size);
+
+// True when SNAPSHOT_MIN_INTERVAL has passed since the last write.
+bool snapshotDue();
+
+// Store the writer's bytes unless they match the stored snapshot.
+void snapshotSave(const SnapshotWriter &writer);
+
+// Print write counters to Serial.
+void snapshotPrintStats();
+
+#endif
@@ -0,0 +1,86 @@
+// Server-Sent Events subscription over a plain HTTP/1.1 socket
+//
+// Keeps one long-lived GET open to a text/event-stream endpoint and hands
+// each complete event (event name + data) to a callback. Reading is
+// non-blocking: poll() consumes whatever has arrived and returns, so the
+// fetch worker can call it from its idle loop. Chunked transfer encoding is
+// decoded. The stream counts as healthy while bytes (events or ": keepalive"
+// comments) keep arriving within SSE_STALE_TIMEOUT; a dropped or stale stream
+// is reopened with exponential backoff. Connections go to the address from
+// the DNS cache.
+//
+// Not thread safe: only the fetch worker task may call poll().
+
+#ifndef SSE_CLIENT_H
+#define SSE_CLIENT_H
+
+#include <WiFi.h>
+
+const unsigned long SSE_CONNECT_TIMEOUT = 3000;        // TCP connect and response headers
+const unsigned long SSE_STALE_TIMEOUT = 45000;         // Server should send a keepalive every 15 seconds
+const unsigned long SSE_RETRY_MIN = 2000;              // First reconnect delay
+const unsigned long SSE_RETRY_MAX = 60000;             // Reconnect backoff cap
+const unsigned long SSE_UNSUPPORTED_RETRY = 600000;    // Server answered 404: ask again in 10 minutes
+const size_t SSE_MAX_LINE = 1024;                      // Longer data lines are dropped
+
+class SseClient {
+public:
+    typedef void (*EventHandler)(const String &event, const String &data);
+
+    SseClient(const char *host, uint16_t port, const char *path, EventHandler handler);
+
+    // Connect when due, read what has arrived and dispatch complete events.
+    void poll();
+
+    // Connected, headers accepted and the server was heard from recently.
+    bool healthy() const;
+
+    // True once after each successful (re)connect, so the caller can resync
+    // anything that changed while the stream was down.
+    bool takeReconnected();
+
+    void stop();
+    void printStats() const;
+
+private:
+    enum State { IDLE, READING_HEADERS, STREAMING };
+    enum ChunkState { CHUNK_SIZE, CHUNK_DATA, CHUNK_DATA_END };
+
+    void connect();
+    void fail(unsigned long delayMs);
+    void backoff();
+    void receive(char c);
+    void processHeaderLine();
+    void feed(char c);
+    void processLine();
+
+    WiFiClient client;
+    const char *host;
+    uint16_t port;
+    const char *path;
+    EventHandler handler;
+
+    State state;
+    unsigned long stateSince;    // millis() of the last state change
+    unsigned long lastActivity;  // millis() of the last byte received
+    unsigned long retryAt;       // millis() of the next connect attempt
+    unsigned long retryDelay;    // Current backoff
+    bool reconnected;
+
+    bool chunked;
+    ChunkState chunkState;
+    long chunkRemaining;
+    bool chunkExtension;
+
+    String line;
+    bool lineTooLong;
+    int statusCode;      // 0 until the status line has been read
+    String eventName;
+    String eventData;
+    bool dropEvent;      // Part of the current event was too long; skip it
+
+    unsigned long eventCount;
+    unsigned long connectCount;
+};
+
+#endif
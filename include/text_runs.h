@@ -0,0 +1,37 @@
+// Glyph-level change tracking for single lines of status text
+//
+// A TextRun remembers the text, colour, font and panel position of one line
+// as it is (or, until the next region flush, is about to be) on the panel.
+// Given the new text, textRunUpdate() works out the smallest span of glyph
+// cells that differs: the common prefix and suffix stay put, and only the
+// cells between them are returned. When the differing middle changed width,
+// the suffix has moved, so the span runs to the end of the longer of the two
+// texts, which also covers the trailing area left by a shorter string. A
+// colour, font or position change returns both extents whole. Marking only
+// that span dirty keeps a price moving from 495.28 to 495.31 down to a few
+// glyph cells on the wire instead of the whole line.
+//
+// Not thread safe: use from loop() only.
+
+#ifndef TEXT_RUNS_H
+#define TEXT_RUNS_H
+
+#include <Arduino.h>
+#include "screen_regions.h"
+
+struct TextRun {
+    String text;
+    uint16_t color;
+    int16_t x, y;    // Panel position of the text's top left
+    uint8_t font;
+};
+
+// Record that run now shows text in color and font at (x, y), measured at text
+// size 1 with the cached font metrics, and return the panel rectangle that has
+// to be repainted (empty when nothing changed).
+ScreenRect textRunUpdate(TextRun &run, const String &text, uint16_t color, int x, int y, uint8_t font);
+
+// Print update counts and the changed area against whole-line repaints to Serial.
+void textRunsPrintStats();
+
+#endif
@@ -0,0 +1,31 @@
+// System clock kept in sync by the ESP-IDF SNTP client
+//
+// SNTP runs in the lwIP task and polls the configured servers every
+// TIME_SYNC_INTERVAL, moving to the next server when one does not answer, so
+// reading the time never waits on the network. The first reply sets the clock.
+// Later ones are applied in smooth mode: adjtime() slews the clock towards the
+// server time instead of stepping it, so the seconds display never jumps or
+// repeats. Each sync records the offset that was corrected and, from the
+// server time elapsed against the local timer, the crystal's drift in ppm.
+//
+// Thread safe: timeSyncBegin() once from loop(), the rest from any task.
+
+#ifndef TIME_SYNC_H
+#define TIME_SYNC_H
+
+#include <Arduino.h>
+#include <time.h>
+
+const uint32_t TIME_SYNC_INTERVAL = 3600000;           // SNTP poll period; the crystal drifts a few ms per hour
+const int TIME_SYNC_SERVER_COUNT = 3;                  // lwIP's SNTP_MAX_SERVERS in the Arduino build
+
+// Start SNTP against up to TIME_SYNC_SERVER_COUNT servers (NULL entries are skipped).
+void timeSyncBegin(const char *const servers[TIME_SYNC_SERVER_COUNT]);
+
+// The clock has been set from a server at least once.
+bool timeSyncValid();
+
+// Print sync count, last offset, drift, slew in progress and sync age to Serial.
+void timeSyncPrintStats();
+
+#endif
@@ -0,0 +1,43 @@
+// Wi-Fi station link with fast reconnect
+//
+// A plain WiFi.begin() scans every channel on each join. After the first
+// successful join the AP's BSSID and channel and the DHCP lease (address,
+// gateway, mask, DNS) are kept in NVS, and later joins go straight to that
+// BSSID on that channel. They still run DHCP unless WIFI_REUSE_LEASE is set,
+// which applies the cached address statically. That skips DHCP but never
+// renews the lease, so only enable it with a DHCP reservation for the display.
+// If a fast join does not complete within WIFI_FAST_JOIN_TIMEOUT, the next
+// attempts fall back to a full scan with DHCP until one succeeds and refreshes
+// the cache.
+// Disconnects arrive as Wi-Fi events; the link then rejoins in the background
+// with exponential backoff and reports how long it was down. NVS is written
+// only when the AP or lease actually changed.
+//
+// Not thread safe: only loop() may use the link, except wifiLinkUp(), which
+// any task may call.
+
+#ifndef WIFI_LINK_H
+#define WIFI_LINK_H
+
+#include <WiFi.h>
+
+const unsigned long WIFI_FAST_JOIN_TIMEOUT = 3000;     // Known BSSID/channel; an AP answers well within this
+const unsigned long WIFI_JOIN_TIMEOUT = 15000;         // Full scan + DHCP
+const unsigned long WIFI_LEAVE_TIMEOUT = 1000;         // Wait for a dropped attempt's disconnect event
+const unsigned long WIFI_RETRY_MIN = 1000;             // First rejoin delay after a failed attempt
+const unsigned long WIFI_RETRY_MAX = 30000;            // Rejoin backoff cap
+const bool WIFI_REUSE_LEASE = false;                   // Skip DHCP with the cached lease (needs a DHCP reservation)
+
+// Load the cached AP and lease and start joining in the background.
+void wifiLinkBegin(const char *ssid, const char *password);
+
+// Handle Wi-Fi events, join timeouts and backoff. Call every loop() iteration.
+void wifiLinkPoll();
+
+// Associated and holding an address.
+bool wifiLinkUp();
+
+// Print state, join times, outages and the cached AP to Serial.
+void wifiLinkPrintStats();
+
+#endif
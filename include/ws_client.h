@@ -0,0 +1,99 @@
+// Minimal WebSocket (RFC 6455) client for JSON-RPC text messages
+//
+// Opens ws://host:port/path, completes the HTTP upgrade (checking the server's
+// Sec-WebSocket-Accept against the key sent) and then reads frames
+// without blocking: poll() consumes whatever has arrived and hands each
+// complete text message to a callback. Pings are answered, the connection is
+// pinged when quiet and dropped when nothing arrives for WS_STALE_TIMEOUT.
+// A refused or lost connection is retried with exponential backoff, so a
+// powered-off printer costs one short connect attempt per backoff period.
+// Binary messages and TLS (wss://) are not supported.
+//
+// Not thread safe: only the fetch worker task may use a client.
+
+#ifndef WS_CLIENT_H
+#define WS_CLIENT_H
+
+#include <WiFi.h>
+
+const unsigned long WS_CONNECT_TIMEOUT = 1000;         // LAN hosts answer fast; keep offline printers cheap
+const unsigned long WS_HANDSHAKE_TIMEOUT = 3000;       // Upgrade response
+const unsigned long WS_PING_INTERVAL = 30000;          // Ping when nothing was received for this long
+const unsigned long WS_STALE_TIMEOUT = 75000;          // Drop the connection after this much silence
+const unsigned long WS_RETRY_MIN = 2000;               // First reconnect delay
+const unsigned long WS_RETRY_MAX = 60000;              // Reconnect backoff cap
+const size_t WS_MAX_MESSAGE = 2048;                    // Longer messages are dropped
+
+class WebSocketClient {
+public:
+    typedef void (*MessageHandler)(void *context, const String &message);
+
+    WebSocketClient();
+
+    void begin(const String &host, uint16_t port, const char *path, MessageHandler handler, void *context);
+
+    // Connect when due, read what has arrived and dispatch complete messages.
+    void poll();
+
+    // Upgrade completed and the connection is open.
+    bool connected() const;
+
+    // True once after each successful (re)connect, so the caller can subscribe.
+    bool takeConnected();
+
+    bool sendText(const String &text);
+    void stop();
+    void printStats(const String &label) const;
+
+private:
+    enum State { IDLE, HANDSHAKE, OPEN };
+    enum FrameState { FRAME_OPCODE, FRAME_LENGTH, FRAME_EXTENDED_LENGTH, FRAME_MASK, FRAME_PAYLOAD };
+
+    void connect();
+    void fail(unsigned long delayMs);
+    void backoff();
+    void receiveHandshake(char c);
+    void receiveFrame(uint8_t b);
+    void startPayload();
+    void finishFrame();
+    bool sendFrame(uint8_t opcode, const uint8_t *payload, size_t length);
+
+    WiFiClient client;
+    String host;
+    uint16_t port;
+    const char *path;
+    MessageHandler handler;
+    void *context;
+
+    State state;
+    unsigned long stateSince;    // millis() of the last state change
+    unsigned long lastActivity;  // millis() of the last byte received
+    unsigned long lastPing;      // millis() of the last ping sent
+    unsigned long retryAt;       // millis() of the next connect attempt
+    unsigned long retryDelay;    // Current backoff
+    bool justConnected;
+
+    String line;                 // Handshake response line
+    int statusCode;              // 0 until the status line has been read
+    String expectedAccept;       // Sec-WebSocket-Accept the server must send
+    bool acceptValid;            // The upgrade response carried it
+
+    FrameState frameState;
+    uint8_t opcode;              // Opcode of the frame being read
+    uint8_t messageOpcode;       // Opcode of the (possibly fragmented) message
+    bool fin;
+    bool masked;
+    uint8_t lengthBytes;         // Extended length bytes still to read
+    uint8_t maskBytes;           // Mask key bytes still to read (servers should not mask)
+    uint8_t maskKey[4];
+    uint64_t payloadLength;
+    uint64_t payloadRead;
+    String control;              // Payload of a ping/close frame
+    String message;
+    bool dropMessage;            // Message exceeded WS_MAX_MESSAGE
+
+    unsigned long messageCount;
+    unsigned long connectCount;
+};
+
+#endif
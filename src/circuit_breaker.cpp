@@ -0,0 +1,142 @@
+#include "circuit_breaker.h"
+
+enum BreakerState { BREAKER_CLOSED, BREAKER_OPEN, BREAKER_HALF_OPEN };
+
+struct Breaker {
+    String host;                 // Empty when the slot is free
+    BreakerState state;
+    int failStreak;              // Consecutive failures
+    unsigned long openPeriod;    // Length of the current (or next) open period
+    unsigned long reopenAt;      // millis() when an open circuit turns half-open
+    unsigned long probeAt;       // millis() the half-open probe went out, 0 if none
+
+    // Counters for the "health" serial command
+    unsigned long failures;
+    unsigned long rejected;      // Requests refused while open
+    unsigned long opens;
+};
+
+static Breaker breakers[BREAKER_COUNT];
+
+static const char *stateName(BreakerState state) {
+    switch (state) {
+        case BREAKER_OPEN: return "open";
+        case BREAKER_HALF_OPEN: return "half-open";
+        default: return "closed";
+    }
+}
+
+static Breaker *findBreaker(const char *host, bool create) {
+    Breaker *slot = NULL;
+    for (int i = 0; i < BREAKER_COUNT; i++) {
+        if (breakers[i].host.length() == 0) {
+            if (slot == NULL) {
+                slot = &breakers[i];
+            }
+        } else if (breakers[i].host == host) {
+            return &breakers[i];
+        }
+    }
+    if (!create || slot == NULL) {
+        return NULL;  // Untracked hosts are never blocked
+    }
+    slot->host = host;
+    slot->state = BREAKER_CLOSED;
+    slot->failStreak = 0;
+    slot->openPeriod = BREAKER_OPEN_MIN;
+    slot->reopenAt = 0;
+    slot->probeAt = 0;
+    slot->failures = 0;
+    slot->rejected = 0;
+    slot->opens = 0;
+    return slot;
+}
+
+static void openCircuit(Breaker &breaker) {
+    // Up to 25% jitter so a recovering Pi is not hit by every client at once
+    unsigned long period = breaker.openPeriod + random(breaker.openPeriod / 4 + 1);
+    breaker.state = BREAKER_OPEN;
+    breaker.reopenAt = millis() + period;
+    breaker.probeAt = 0;
+    breaker.opens++;
+    Serial.println("Circuit for " + breaker.host + " open for " + String(period / 1000) + "s");
+    breaker.openPeriod = min(breaker.openPeriod * 2, BREAKER_OPEN_MAX);
+}
+
+bool breakerAllow(const char *host) {
+    Breaker *breaker = findBreaker(host, false);
+    if (breaker == NULL) {
+        return true;
+    }
+    unsigned long now = millis();
+    if (breaker->state == BREAKER_OPEN && (long)(now - breaker->reopenAt) >= 0) {
+        breaker->state = BREAKER_HALF_OPEN;
+    }
+    if (breaker->state == BREAKER_HALF_OPEN) {
+        if (breaker->probeAt == 0 || now - breaker->probeAt >= BREAKER_PROBE_TIMEOUT) {
+            breaker->probeAt = now;  // This request is the probe
+            return true;
+        }
+    } else if (breaker->state == BREAKER_CLOSED) {
+        return true;
+    }
+    breaker->rejected++;
+    return false;
+}
+
+void breakerRecord(const char *host, int httpCode) {
+    bool failed = httpCode < 0 || httpCode >= 500 || httpCode == 429;
+    Breaker *breaker = findBreaker(host, failed);
+    if (breaker == NULL) {
+        return;  // Healthy and never failed: nothing to track
+    }
+
+    if (!failed) {
+        if (breaker->state != BREAKER_CLOSED) {
+            Serial.println("Circuit for " + breaker->host + " closed");
+        }
+        breaker->state = BREAKER_CLOSED;
+        breaker->failStreak = 0;
+        breaker->openPeriod = BREAKER_OPEN_MIN;
+        breaker->probeAt = 0;
+        return;
+    }
+
+    breaker->failures++;
+    breaker->failStreak++;
+    if (breaker->state == BREAKER_HALF_OPEN ||
+        (breaker->state == BREAKER_CLOSED && breaker->failStreak >= BREAKER_FAILURE_THRESHOLD)) {
+        openCircuit(*breaker);
+    }
+}
+
+void breakerProbeNow() {
+    for (int i = 0; i < BREAKER_COUNT; i++) {
+        if (breakers[i].host.length() > 0 && breakers[i].state == BREAKER_OPEN) {
+            breakers[i].state = BREAKER_HALF_OPEN;
+            breakers[i].probeAt = 0;
+        }
+    }
+}
+
+void breakerPrintStats() {
+    bool any = false;
+    for (int i = 0; i < BREAKER_COUNT; i++) {
+        const Breaker &breaker = breakers[i];
+        if (breaker.host.length() == 0) {
+            continue;
+        }
+        any = true;
+        String line = "Circuit " + breaker.host + ": " + stateName(breaker.state) +
+                      ", " + String(breaker.failStreak) + " consecutive failures (" + String(breaker.failures) + " total), " +
+                      String(breaker.opens) + " opens, " + String(breaker.rejected) + " requests refused";
+        if (breaker.state == BREAKER_OPEN) {
+            long wait = (long)(breaker.reopenAt - millis()) / 1000;
+            line += ", probe in " + String(wait > 0 ? wait : 0) + "s";
+        }
+        Serial.println(line);
+    }
+    if (!any) {
+        Serial.println("Circuits: no failures recorded");
+    }
+}
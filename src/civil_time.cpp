@@ -0,0 +1,55 @@
+#include "civil_time.h"
+#include <stdlib.h>
+
+#ifdef ARDUINO
+static const char *WEEKDAY_NAMES[7] = {"Sunday", "Monday", "Tuesday", "Wednesday",
+                                       "Thursday", "Friday", "Saturday"};
+static const char *MONTH_NAMES[12] = {"January", "February", "March", "April", "May", "June", "July",
+                                      "August", "September", "October", "November", "December"};
+#endif
+
+void civilTimeBegin(const char *posixTz) {
+    setenv("TZ", posixTz, 1);
+    tzset();
+}
+
+CivilTime civilTimeFromUtc(time_t utc) {
+    struct tm local;
+    localtime_r(&utc, &local);
+
+    CivilTime time;
+    time.year = local.tm_year + 1900;
+    time.month = local.tm_mon + 1;
+    time.day = local.tm_mday;
+    time.weekday = local.tm_wday;
+    time.hour = local.tm_hour;
+    time.minute = local.tm_min;
+    time.second = local.tm_sec;
+    time.dst = local.tm_isdst > 0;
+    // Local wall clock read as if it were UTC, minus the real UTC
+    long localSeconds = civilDayNumber(time.year, time.month, time.day) * 86400L +
+                        time.hour * 3600L + time.minute * 60L + time.second;
+    time.utcOffset = localSeconds - (long)utc;
+    return time;
+}
+
+// Howard Hinnant's days_from_civil: shift the year to start in March so the
+// leap day is last, then count whole 400-year eras
+long civilDayNumber(int year, int month, int day) {
+    year -= month <= 2;
+    long era = (year >= 0 ? year : year - 399) / 400;
+    long yearOfEra = year - era * 400;                                        // [0, 399]
+    long dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;  // [0, 365]
+    long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;   // [0, 146096]
+    return era * 146097 + dayOfEra - 719468;
+}
+
+#ifdef ARDUINO
+String civilFormatDate(const CivilTime &time) {
+    return String(WEEKDAY_NAMES[time.weekday]) + ", " + MONTH_NAMES[time.month - 1] + " " + String(time.day);
+}
+#endif
+
+const char *civilZoneName(const CivilTime &time) {
+    return tzname[time.dst ? 1 : 0];
+}
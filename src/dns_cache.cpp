@@ -0,0 +1,127 @@
+#include "dns_cache.h"
+
+struct DnsEntry {
+    String host;             // Empty when the entry is free
+    IPAddress ip;
+    bool resolved;           // false = negative entry, ip is not valid
+    bool hasAddress;         // A good address is known (kept across failed refreshes)
+    unsigned long refreshAt; // millis() when the entry is due for another lookup
+};
+
+static DnsEntry cache[DNS_CACHE_SIZE];
+
+// Counters for the "stats" serial command
+static unsigned long dnsHits = 0;          // Served from cache
+static unsigned long dnsMisses = 0;        // Blocking lookups on the request path
+static unsigned long dnsRefreshes = 0;     // Background lookups from the idle pass
+static unsigned long dnsFailures = 0;      // Lookups that did not resolve
+static unsigned long dnsLookupTotal = 0;   // Time spent in all lookups (ms)
+
+static DnsEntry *findEntry(const char *host) {
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        if (cache[i].host.length() > 0 && cache[i].host == host) {
+            return &cache[i];
+        }
+    }
+    return NULL;
+}
+
+// Resolve entry->host now and update the entry
+static void lookup(DnsEntry &entry) {
+    IPAddress ip;
+    unsigned long start = millis();
+    bool ok = WiFi.hostByName(entry.host.c_str(), ip) == 1 && ip != IPAddress(0, 0, 0, 0);
+    dnsLookupTotal += millis() - start;
+
+    if (ok) {
+        entry.ip = ip;
+        entry.resolved = true;
+        entry.hasAddress = true;
+        entry.refreshAt = millis() + DNS_CACHE_TTL - DNS_REFRESH_AHEAD;
+    } else {
+        dnsFailures++;
+        // Keep serving the last good address; the next connect failure invalidates it
+        entry.resolved = entry.hasAddress;
+        entry.refreshAt = millis() + DNS_NEGATIVE_TTL;
+        Serial.println("DNS lookup failed for " + entry.host);
+    }
+}
+
+// Shared by both resolve calls; retryFailed allows a blocking retry of an expired negative entry
+static bool resolve(const char *host, IPAddress &ip, bool retryFailed) {
+    DnsEntry *entry = findEntry(host);
+    if (entry == NULL) {
+        // Take a free entry, or the one due for refresh soonest
+        for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+            if (cache[i].host.length() == 0) {
+                entry = &cache[i];
+                break;
+            }
+            if (entry == NULL || (long)(cache[i].refreshAt - entry->refreshAt) < 0) {
+                entry = &cache[i];
+            }
+        }
+        entry->host = host;
+        entry->hasAddress = false;
+        dnsMisses++;
+        lookup(*entry);
+    } else if (retryFailed && !entry->resolved && (long)(millis() - entry->refreshAt) >= 0) {
+        // Negative entry expired and the idle pass has not retried it yet
+        dnsMisses++;
+        lookup(*entry);
+    } else {
+        dnsHits++;
+    }
+
+    if (!entry->resolved) {
+        return false;
+    }
+    ip = entry->ip;
+    return true;
+}
+
+bool dnsCacheResolve(const char *host, IPAddress &ip) {
+    return resolve(host, ip, true);
+}
+
+bool dnsCacheResolveCached(const char *host, IPAddress &ip) {
+    return resolve(host, ip, false);
+}
+
+void dnsCacheInvalidate(const char *host) {
+    DnsEntry *entry = findEntry(host);
+    if (entry != NULL) {
+        entry->resolved = false;
+        entry->hasAddress = false;
+        entry->refreshAt = millis();  // Look up again on the next resolve or idle pass
+    }
+}
+
+void dnsCacheRefresh() {
+    unsigned long now = millis();
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        DnsEntry &entry = cache[i];
+        if (entry.host.length() == 0) {
+            continue;
+        }
+        if ((long)(now - entry.refreshAt) >= 0) {
+            dnsRefreshes++;
+            lookup(entry);
+            return;  // One lookup per pass keeps the worker responsive to requests
+        }
+    }
+}
+
+void dnsCachePrintStats() {
+    Serial.println("DNS cache: " + String(dnsHits) + " hits, " + String(dnsMisses) + " misses, " +
+                   String(dnsRefreshes) + " background refreshes, " + String(dnsFailures) + " failures, " +
+                   String(dnsLookupTotal) + "ms in lookups");
+    for (int i = 0; i < DNS_CACHE_SIZE; i++) {
+        const DnsEntry &entry = cache[i];
+        if (entry.host.length() > 0) {
+            long ttl = (long)(entry.refreshAt - millis()) / 1000;
+            Serial.println("  " + entry.host + " -> " + (entry.resolved ? entry.ip.toString() : String("unresolved")) +
+                           " (refresh in " + String(ttl > 0 ? ttl : 0) + "s)");
+        }
+    }
+}
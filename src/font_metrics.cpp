@@ -0,0 +1,79 @@
+#include "font_metrics.h"
+
+static const uint8_t CACHED_FONTS[] = {1, 2, 4};
+static const int CACHED_FONT_COUNT = sizeof(CACHED_FONTS);
+static const int FIRST_CHAR = 32;
+static const int CHAR_COUNT = 96;   // Printable ASCII and DEL, as in the font tables
+
+static uint8_t widths[CACHED_FONT_COUNT][CHAR_COUNT];
+static uint8_t heights[CACHED_FONT_COUNT];
+static bool measured = false;
+
+static int slot(uint8_t font) {
+    for (int i = 0; i < CACHED_FONT_COUNT; i++) {
+        if (CACHED_FONTS[i] == font) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Decode the character at byte index and step past it, as TFT_eSPI's
+// decodeUTF8() does for drawString(): a lead byte takes its continuation bytes
+// without checking them, and a stray byte stands for itself
+static uint16_t decodeUtf8(const String &text, int &index) {
+    int remaining = text.length() - index;
+    uint8_t c = text[index++];
+    if ((c & 0xE0) == 0xC0 && remaining > 1) {
+        return ((c & 0x1F) << 6) | (text[index++] & 0x3F);
+    }
+    if ((c & 0xF0) == 0xE0 && remaining > 2) {
+        uint16_t code = ((c & 0x0F) << 12) | ((text[index] & 0x3F) << 6) | (text[index + 1] & 0x3F);
+        index += 2;
+        return code;
+    }
+    if ((c & 0xF8) == 0xF0 && remaining > 3) {
+        uint16_t code = ((c & 0x07) << 18) | ((text[index] & 0x3F) << 12) | ((text[index + 1] & 0x3F) << 6) |
+                        (text[index + 2] & 0x3F);
+        index += 3;
+        return code;
+    }
+    return c;
+}
+
+void fontMetricsBegin(TFT_eSPI &tft) {
+    tft.setTextSize(1);
+    for (int f = 0; f < CACHED_FONT_COUNT; f++) {
+        heights[f] = tft.fontHeight(CACHED_FONTS[f]);
+        for (int c = 0; c < CHAR_COUNT; c++) {
+            char text[2] = {(char)(FIRST_CHAR + c), 0};
+            widths[f][c] = tft.textWidth(text, CACHED_FONTS[f]);
+        }
+    }
+    measured = true;
+}
+
+int fontTextWidth(const String &text, uint8_t font, int from, int to) {
+    int f = slot(font);
+    if (!measured || f < 0) {
+        return 0;
+    }
+    int end = (to < 0 || to > (int)text.length()) ? text.length() : to;
+    int width = 0;
+    int i = from;
+    while (i < end) {
+        uint16_t c = decodeUtf8(text, i);
+        if (c >= FIRST_CHAR && c < FIRST_CHAR + CHAR_COUNT) {
+            width += widths[f][c - FIRST_CHAR];
+        } else if (CACHED_FONTS[f] == 1) {
+            width += widths[f][0];   // GLCD cells are all the same width, whatever the character
+        }
+        // Fonts 2 and 4 have no glyph for it and drawChar() does not advance
+    }
+    return width;
+}
+
+int fontLineHeight(uint8_t font) {
+    int f = slot(font);
+    return (measured && f >= 0) ? heights[f] : 0;
+}
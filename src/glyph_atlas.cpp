@@ -0,0 +1,107 @@
+#include "glyph_atlas.h"
+
+static int glyphIndex(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    return c == ':' ? 10 : -1;
+}
+
+static int rowBytes(int width) {
+    return (width + 7) / 8;
+}
+
+bool glyphAtlasBuild(GlyphAtlas &atlas, TFT_eSPI &parent, uint8_t font, uint8_t size) {
+    TFT_eSprite glyph = TFT_eSprite(&parent);
+    glyph.setColorDepth(1);
+    glyph.setTextSize(size);
+    atlas.height = glyph.fontHeight(font);
+
+    // Lay the masks out first so one allocation holds them all
+    int widest = 0;
+    size_t total = 0;
+    for (int i = 0; i < GLYPH_ATLAS_COUNT; i++) {
+        char text[2] = {GLYPH_ATLAS_CHARS[i], 0};
+        atlas.widths[i] = glyph.textWidth(text, font);
+        atlas.offsets[i] = total;
+        total += rowBytes(atlas.widths[i]) * atlas.height;
+        widest = max(widest, (int)atlas.widths[i]);
+    }
+    free(atlas.bits);
+    atlas.bits = (uint8_t *)calloc(total, 1);
+    if (atlas.bits == NULL || glyph.createSprite(widest, atlas.height) == NULL) {
+        free(atlas.bits);
+        atlas.bits = NULL;
+        return false;
+    }
+
+    glyph.setTextColor(1);
+    for (int i = 0; i < GLYPH_ATLAS_COUNT; i++) {
+        glyph.fillSprite(0);
+        glyph.drawChar(GLYPH_ATLAS_CHARS[i], 0, 0, font);
+        uint8_t *mask = atlas.bits + atlas.offsets[i];
+        int stride = rowBytes(atlas.widths[i]);
+        for (int y = 0; y < atlas.height; y++) {
+            for (int x = 0; x < atlas.widths[i]; x++) {
+                if (glyph.readPixel(x, y) != 0) {
+                    mask[y * stride + x / 8] |= 0x80 >> (x % 8);
+                }
+            }
+        }
+    }
+    glyph.deleteSprite();
+    return true;
+}
+
+bool glyphAtlasCovers(const GlyphAtlas &atlas, const String &text) {
+    if (atlas.bits == NULL) {
+        return false;
+    }
+    for (unsigned int i = 0; i < text.length(); i++) {
+        if (glyphIndex(text[i]) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int glyphAtlasTextWidth(const GlyphAtlas &atlas, const String &text, int count) {
+    int end = (count < 0 || count > (int)text.length()) ? text.length() : count;
+    int width = 0;
+    for (int i = 0; i < end; i++) {
+        int index = glyphIndex(text[i]);
+        if (index >= 0) {
+            width += atlas.widths[index];
+        }
+    }
+    return width;
+}
+
+int glyphAtlasDraw(const GlyphAtlas &atlas, TFT_eSPI &out, const String &text, int x, int y, uint16_t color) {
+    int start = x;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        int index = glyphIndex(text[i]);
+        if (index < 0 || atlas.bits == NULL) {
+            continue;
+        }
+        const uint8_t *mask = atlas.bits + atlas.offsets[index];
+        int width = atlas.widths[index];
+        int stride = rowBytes(width);
+        for (int row = 0; row < atlas.height; row++) {
+            const uint8_t *line = mask + row * stride;
+            // One fast line per run of set pixels
+            int run = -1;
+            for (int col = 0; col <= width; col++) {
+                bool set = col < width && (line[col / 8] & (0x80 >> (col % 8))) != 0;
+                if (set && run < 0) {
+                    run = col;
+                } else if (!set && run >= 0) {
+                    out.drawFastHLine(x + run, y + row, col - run, color);
+                    run = -1;
+                }
+            }
+        }
+        x += width;
+    }
+    return x - start;
+}
@@ -0,0 +1,172 @@
+#include "http_multi.h"
+#include "dns_cache.h"
+#include <lwip/sockets.h>
+#include <errno.h>
+
+enum SlotPhase { PHASE_CONNECTING, PHASE_RECEIVING, PHASE_DONE };
+
+struct MultiSlot {
+    int fd;
+    SlotPhase phase;
+    String response;  // Raw status line, headers and body
+};
+
+// Split a complete "HTTP/1.x 200 OK\r\n...\r\n\r\nbody" response
+static void finishResponse(HttpMultiRequest &request, MultiSlot &slot) {
+    int space = slot.response.indexOf(' ');
+    int headerEnd = slot.response.indexOf("\r\n\r\n");
+    if (!slot.response.startsWith("HTTP/") || space < 0 || headerEnd < 0) {
+        request.status = HTTPC_ERROR_NO_HTTP_SERVER;
+        return;
+    }
+    request.status = slot.response.substring(space + 1, space + 4).toInt();
+    request.body = slot.response.substring(headerEnd + 4);
+}
+
+static void closeSlot(MultiSlot &slot) {
+    if (slot.fd >= 0) {
+        close(slot.fd);
+        slot.fd = -1;
+    }
+    slot.phase = PHASE_DONE;
+}
+
+void httpMultiGet(HttpMultiRequest *requests, int count, unsigned long timeoutMs) {
+    if (count > HTTP_MULTI_MAX_REQUESTS) {
+        count = HTTP_MULTI_MAX_REQUESTS;
+    }
+    MultiSlot slots[HTTP_MULTI_MAX_REQUESTS];
+    unsigned long start = millis();
+
+    // Start every connect before waiting on any of them
+    for (int i = 0; i < count; i++) {
+        HttpMultiRequest &request = requests[i];
+        MultiSlot &slot = slots[i];
+        request.status = HTTPC_ERROR_CONNECTION_REFUSED;
+        request.body = "";
+        request.elapsed = 0;
+        slot.fd = -1;
+        slot.phase = PHASE_DONE;
+
+        // A host that failed to resolve is retried by the worker's idle pass, not
+        // here, so one unreachable printer does not hold up the others' connects
+        IPAddress ip;
+        if (!dnsCacheResolveCached(request.host.c_str(), ip)) {
+            continue;
+        }
+        slot.fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (slot.fd < 0) {
+            request.status = HTTPC_ERROR_TOO_LESS_RAM;
+            continue;
+        }
+        fcntl(slot.fd, F_SETFL, fcntl(slot.fd, F_GETFL, 0) | O_NONBLOCK);
+
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(request.port);
+        addr.sin_addr.s_addr = (uint32_t)ip;
+        if (connect(slot.fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 && errno != EINPROGRESS) {
+            dnsCacheInvalidate(request.host.c_str());
+            closeSlot(slot);
+            continue;
+        }
+        slot.phase = PHASE_CONNECTING;
+    }
+
+    // One select() loop drives every socket until all are done or the deadline passes
+    for (;;) {
+        unsigned long elapsed = millis() - start;
+        if (elapsed >= timeoutMs) {
+            break;
+        }
+
+        fd_set readSet, writeSet;
+        FD_ZERO(&readSet);
+        FD_ZERO(&writeSet);
+        int maxFd = -1;
+        for (int i = 0; i < count; i++) {
+            if (slots[i].phase == PHASE_CONNECTING) {
+                FD_SET(slots[i].fd, &writeSet);
+            } else if (slots[i].phase == PHASE_RECEIVING) {
+                FD_SET(slots[i].fd, &readSet);
+            } else {
+                continue;
+            }
+            if (slots[i].fd > maxFd) {
+                maxFd = slots[i].fd;
+            }
+        }
+        if (maxFd < 0) {
+            break;  // Every request finished
+        }
+
+        unsigned long remaining = timeoutMs - elapsed;
+        struct timeval tv;
+        tv.tv_sec = remaining / 1000;
+        tv.tv_usec = (remaining % 1000) * 1000;
+        int ready = select(maxFd + 1, &readSet, &writeSet, NULL, &tv);
+        if (ready < 0) {
+            break;
+        }
+
+        for (int i = 0; i < count; i++) {
+            HttpMultiRequest &request = requests[i];
+            MultiSlot &slot = slots[i];
+
+            if (slot.phase == PHASE_CONNECTING && FD_ISSET(slot.fd, &writeSet)) {
+                int error = 0;
+                socklen_t length = sizeof(error);
+                getsockopt(slot.fd, SOL_SOCKET, SO_ERROR, &error, &length);
+                if (error != 0) {
+                    request.status = HTTPC_ERROR_CONNECTION_REFUSED;
+                    request.elapsed = millis() - start;
+                    closeSlot(slot);
+                    continue;
+                }
+                String header = "GET " + request.path + " HTTP/1.0\r\n" +
+                                "Host: " + request.host + "\r\n" +
+                                "Connection: close\r\n\r\n";
+                // A request this small always fits the empty socket send buffer
+                if (send(slot.fd, header.c_str(), header.length(), 0) != (int)header.length()) {
+                    request.status = HTTPC_ERROR_SEND_HEADER_FAILED;
+                    request.elapsed = millis() - start;
+                    closeSlot(slot);
+                    continue;
+                }
+                slot.phase = PHASE_RECEIVING;
+            } else if (slot.phase == PHASE_RECEIVING && FD_ISSET(slot.fd, &readSet)) {
+                char buffer[256];
+                int n = recv(slot.fd, buffer, sizeof(buffer), 0);
+                if (n > 0) {
+                    if (slot.response.length() + n > HTTP_MULTI_MAX_RESPONSE) {
+                        request.status = HTTPC_ERROR_TOO_LESS_RAM;
+                        request.elapsed = millis() - start;
+                        closeSlot(slot);
+                        continue;
+                    }
+                    slot.response.concat(buffer, n);
+                } else if (n == 0) {
+                    // Server closed: HTTP/1.0 response is complete
+                    finishResponse(request, slot);
+                    request.elapsed = millis() - start;
+                    closeSlot(slot);
+                } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    request.status = HTTPC_ERROR_CONNECTION_LOST;
+                    request.elapsed = millis() - start;
+                    closeSlot(slot);
+                }
+            }
+        }
+    }
+
+    // Whatever is still open missed the shared deadline
+    for (int i = 0; i < count; i++) {
+        if (slots[i].phase != PHASE_DONE) {
+            requests[i].status = slots[i].phase == PHASE_CONNECTING ? HTTPC_ERROR_CONNECTION_REFUSED
+                                                                    : HTTPC_ERROR_READ_TIMEOUT;
+            requests[i].elapsed = millis() - start;
+            closeSlot(slots[i]);
+        }
+    }
+}
@@ -0,0 +1,384 @@
+#include "http_pool.h"
+#include "dns_cache.h"
+#include "circuit_breaker.h"
+
+static PooledConnection pool[HTTP_POOL_SIZE];
+
+// Validators from the last successful response of each endpoint
+struct ValidatorEntry {
+    String host;          // Empty when the entry is free
+    uint16_t port;
+    String path;
+    String etag;
+    String lastModified;
+};
+static ValidatorEntry validators[HTTP_VALIDATOR_CACHE_SIZE];
+static int nextValidatorSlot = 0;  // Round-robin replacement once the cache is full
+
+// Counters for the "stats" serial command
+static unsigned long poolRequests = 0;      // Requests sent through the pool
+static unsigned long poolReused = 0;        // Requests that went out on an already open socket
+static unsigned long poolReconnects = 0;    // Dead keep-alive sockets reopened transparently
+static unsigned long poolLatencyTotal = 0;  // Send to response headers, all requests (ms)
+static unsigned long poolLatencyReused = 0; // Same, reused sockets only (ms)
+static unsigned long poolNotModified = 0;   // Conditional GETs answered with 304
+static unsigned long poolRefused = 0;       // Requests refused by an open circuit breaker
+
+// Close the socket and forget the host so the next acquire calls begin() again
+static void unbindSlot(PooledConnection &slot) {
+    slot.client.stop();
+    slot.http.end();
+    slot.host = "";
+    slot.port = 0;
+}
+
+static ValidatorEntry *findValidators(const PooledConnection *conn) {
+    for (int i = 0; i < HTTP_VALIDATOR_CACHE_SIZE; i++) {
+        ValidatorEntry &entry = validators[i];
+        if (entry.host.length() > 0 && entry.port == conn->port && entry.path == conn->path &&
+            entry.host == conn->host) {
+            return &entry;
+        }
+    }
+    return NULL;
+}
+
+PooledConnection *httpPoolAcquire(const char *host, uint16_t port, const String &path, uint16_t timeoutMs) {
+    PooledConnection *match = NULL;   // Idle slot already bound to host:port
+    PooledConnection *unbound = NULL; // Idle slot not bound to any server
+    PooledConnection *oldest = NULL;  // Least recently used idle slot
+
+    for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+        PooledConnection &slot = pool[i];
+        if (slot.inUse) {
+            continue;
+        }
+        if (slot.host.length() > 0 && slot.port == port && slot.host == host) {
+            // Prefer a slot whose socket is still open
+            if (match == NULL || (!match->client.connected() && slot.client.connected())) {
+                match = &slot;
+            }
+        } else if (slot.host.length() == 0) {
+            if (unbound == NULL) unbound = &slot;
+        } else if (oldest == NULL || slot.lastUsed < oldest->lastUsed) {
+            oldest = &slot;
+        }
+    }
+
+    PooledConnection *conn = match;
+    if (conn != NULL) {
+        // Same server: only the path changes, HTTPClient keeps the socket
+        conn->http.setURL(path);
+    } else {
+        conn = unbound != NULL ? unbound : oldest;
+        if (conn == NULL) {
+            Serial.println("HTTP pool exhausted, no connection for " + String(host));
+            return NULL;
+        }
+        if (conn->host.length() > 0) {
+            unbindSlot(*conn);  // Evict least recently used connection to another host
+        }
+        conn->http.begin(conn->client, host, port, path);
+        conn->http.setReuse(true);
+        conn->host = host;
+        conn->port = port;
+    }
+
+    // Re-registering drops the values HTTPClient kept from the previous response on this socket
+    httpCollectResponseHeaders(conn->http);
+    conn->path = path;
+    conn->timeoutMs = timeoutMs;
+    conn->http.setTimeout(timeoutMs);
+    conn->http.setConnectTimeout(timeoutMs);
+    conn->inUse = true;
+    return conn;
+}
+
+// Open the socket to the cached address; HTTPClient then finds it connected and skips its own lookup
+static bool connectSlot(PooledConnection *conn) {
+    if (conn->client.connected()) {
+        return true;
+    }
+    IPAddress ip;
+    if (!dnsCacheResolve(conn->host.c_str(), ip)) {
+        return false;
+    }
+    if (!conn->client.connect(ip, conn->port, conn->timeoutMs)) {
+        dnsCacheInvalidate(conn->host.c_str());  // Host may have moved to a new DHCP lease
+        return false;
+    }
+    return true;
+}
+
+// A reused socket the server had already closed fails before the request is
+// delivered. Only such errors are retried, and only for idempotent methods: after
+// a read timeout the server may have acted on the request, so a POST could run twice.
+static bool retryOnFreshSocket(const char *method, int httpCode) {
+    if (strcmp(method, "GET") != 0 && strcmp(method, "HEAD") != 0) {
+        return false;
+    }
+    return httpCode == HTTPC_ERROR_SEND_HEADER_FAILED || httpCode == HTTPC_ERROR_CONNECTION_LOST ||
+           httpCode == HTTPC_ERROR_NOT_CONNECTED;
+}
+
+int httpPoolSend(PooledConnection *conn, const char *method, const String &body) {
+    if (!breakerAllow(conn->host.c_str())) {
+        poolRefused++;
+        return HTTPC_ERROR_CONNECTION_REFUSED;  // Host is down; do not spend a connect on it
+    }
+    if (strcmp(method, "GET") == 0) {
+        ValidatorEntry *entry = findValidators(conn);
+        if (entry != NULL) {
+            // Headers added here are cleared again by end() in httpPoolRelease
+            if (entry->etag.length() > 0) {
+                conn->http.addHeader("If-None-Match", entry->etag);
+            }
+            if (entry->lastModified.length() > 0) {
+                conn->http.addHeader("If-Modified-Since", entry->lastModified);
+            }
+        }
+    }
+
+    bool reused = conn->client.connected();
+    unsigned long start = millis();
+    int httpCode = connectSlot(conn) ? conn->http.sendRequest(method, body) : HTTPC_ERROR_CONNECTION_REFUSED;
+
+    if (reused && retryOnFreshSocket(method, httpCode)) {
+        // Server closed the idle keep-alive socket; open a fresh one and send again
+        conn->client.stop();
+        poolReconnects++;
+        reused = false;
+        start = millis();
+        httpCode = connectSlot(conn) ? conn->http.sendRequest(method, body) : HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+
+    unsigned long elapsed = millis() - start;
+    poolRequests++;
+    poolLatencyTotal += elapsed;
+    if (reused) {
+        poolReused++;
+        poolLatencyReused += elapsed;
+    }
+    if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        poolNotModified++;
+    }
+    breakerRecord(conn->host.c_str(), httpCode);
+    return httpCode;
+}
+
+void httpPoolCacheValidators(PooledConnection *conn) {
+    String etag = conn->http.header("ETag");
+    String lastModified = conn->http.header("Last-Modified");
+    ValidatorEntry *entry = findValidators(conn);
+
+    if (etag.length() == 0 && lastModified.length() == 0) {
+        if (entry != NULL) {
+            entry->host = "";  // Server stopped sending validators for this endpoint
+        }
+        return;
+    }
+    if (entry == NULL) {
+        entry = &validators[nextValidatorSlot];
+        nextValidatorSlot = (nextValidatorSlot + 1) % HTTP_VALIDATOR_CACHE_SIZE;
+        entry->host = conn->host;
+        entry->port = conn->port;
+        entry->path = conn->path;
+    }
+    entry->etag = etag;
+    entry->lastModified = lastModified;
+}
+
+void httpPoolClearValidators() {
+    for (int i = 0; i < HTTP_VALIDATOR_CACHE_SIZE; i++) {
+        validators[i].host = "";
+    }
+}
+
+void httpPoolRelease(PooledConnection *conn) {
+    if (conn == NULL) {
+        return;
+    }
+    // end() keeps the socket open when the server allowed keep-alive
+    conn->http.end();
+    if (!conn->client.connected()) {
+        // HTTPClient dropped its client pointer when it closed the socket; rebind on next use
+        unbindSlot(*conn);
+    }
+    conn->lastUsed = millis();
+    conn->inUse = false;
+}
+
+void httpPoolEvictIdle() {
+    unsigned long now = millis();
+    for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+        PooledConnection &slot = pool[i];
+        if (!slot.inUse && slot.host.length() > 0 && now - slot.lastUsed >= HTTP_POOL_IDLE_TIMEOUT) {
+            unbindSlot(slot);
+        }
+    }
+}
+
+void httpPoolPrintStats() {
+    int open = 0;
+    for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+        if (pool[i].host.length() > 0 && pool[i].client.connected()) {
+            open++;
+        }
+    }
+    unsigned long fresh = poolRequests - poolReused;
+    Serial.println("HTTP pool: " + String(poolRequests) + " requests, " + String(poolReused) + " reused, " +
+                   String(poolReconnects) + " reconnects, " + String(poolNotModified) + " not modified, " +
+                   String(poolRefused) + " refused by circuit breaker, " + String(open) + " open sockets");
+    Serial.println("HTTP latency avg: new socket " + String(fresh > 0 ? (poolLatencyTotal - poolLatencyReused) / fresh : 0) +
+                   "ms, reused " + String(poolReused > 0 ? poolLatencyReused / poolReused : 0) + "ms");
+}
+
+void httpCollectResponseHeaders(HTTPClient &http) {
+    static const char *headers[] = {"Transfer-Encoding", "ETag", "Last-Modified"};
+    http.collectHeaders(headers, sizeof(headers) / sizeof(headers[0]));
+}
+
+HttpBodyStream::HttpBodyStream(HTTPClient &http, unsigned long timeoutMs)
+    : client(http.getStream()), chunked(false), remaining(-1), chunkStarted(false),
+      finished(false), broken(false), timeoutMs(timeoutMs) {
+    String encoding = http.header("Transfer-Encoding");
+    encoding.toLowerCase();
+    chunked = encoding.indexOf("chunked") >= 0;
+    if (chunked) {
+        remaining = 0;  // First read starts the first chunk
+    } else {
+        remaining = http.getSize();  // Content-Length, or -1 if the server did not send one
+    }
+    setTimeout(timeoutMs);
+}
+
+// Blocking single byte read used for chunk framing
+int HttpBodyStream::waitByte() {
+    unsigned long start = millis();
+    while (!client.available()) {
+        if (!client.connected() || millis() - start >= timeoutMs) {
+            return -1;
+        }
+        delay(1);
+    }
+    return client.read();
+}
+
+// Read the next chunk-size line; false once the last chunk has been consumed
+bool HttpBodyStream::nextChunk() {
+    if (chunkStarted) {
+        // CRLF that ends the previous chunk's data
+        if (waitByte() != '\r' || waitByte() != '\n') {
+            broken = finished = true;
+            return false;
+        }
+    }
+
+    long size = 0;
+    bool inExtension = false;
+    int c;
+    while ((c = waitByte()) >= 0 && c != '\r') {
+        if (c == ';') {
+            inExtension = true;  // Chunk extensions are ignored
+        } else if (!inExtension) {
+            int digit = (c >= '0' && c <= '9') ? c - '0' :
+                        (c >= 'a' && c <= 'f') ? c - 'a' + 10 :
+                        (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+            if (digit < 0) {
+                broken = finished = true;
+                return false;
+            }
+            size = size * 16 + digit;
+        }
+    }
+    if (c < 0 || waitByte() != '\n') {
+        broken = finished = true;
+        return false;
+    }
+    chunkStarted = true;
+
+    if (size == 0) {
+        // Last chunk: skip optional trailer lines up to the empty line
+        int lineLength = 0;
+        while ((c = waitByte()) >= 0) {
+            if (c == '\n') {
+                if (lineLength == 0) break;
+                lineLength = 0;
+            } else if (c != '\r') {
+                lineLength++;
+            }
+        }
+        broken = (c < 0);
+        finished = true;
+        return false;
+    }
+
+    remaining = size;
+    return true;
+}
+
+int HttpBodyStream::available() {
+    if (finished) return 0;
+    int buffered = client.available();
+    if (remaining > 0 && buffered > remaining) {
+        return remaining;
+    }
+    return (chunked && remaining == 0) ? 0 : buffered;
+}
+
+int HttpBodyStream::read() {
+    if (finished) return -1;
+    if (chunked && remaining == 0 && !nextChunk()) return -1;
+    if (remaining == 0) {
+        finished = true;  // Content-Length reached
+        return -1;
+    }
+    int c = client.read();  // -1 when nothing has arrived yet; Stream::timedRead retries
+    if (c >= 0 && remaining > 0) {
+        remaining--;
+    }
+    return c;
+}
+
+int HttpBodyStream::peek() {
+    if (finished || remaining == 0) return -1;
+    return client.peek();
+}
+
+bool HttpBodyStream::drain() {
+    uint8_t buffer[64];
+    unsigned long start = millis();
+    while (!finished) {
+        if (remaining < 0) {
+            return false;  // Body ends when the server closes; nothing to reuse
+        }
+        if (remaining == 0) {
+            if (!chunked) {
+                finished = true;
+            } else {
+                nextChunk();
+            }
+            continue;
+        }
+        int n = client.read(buffer, remaining < (long)sizeof(buffer) ? remaining : sizeof(buffer));
+        if (n > 0) {
+            remaining -= n;
+            start = millis();
+        } else if (!client.connected() || millis() - start >= timeoutMs) {
+            return false;
+        } else {
+            delay(1);
+        }
+    }
+    return !broken;
+}
+
+DeserializationError httpParseJsonBody(HTTPClient &http, JsonDocument &doc, JsonDocument &filter) {
+    HttpBodyStream body(http);
+    DeserializationError error = deserializeJson(doc, body, DeserializationOption::Filter(filter));
+    if (!body.drain()) {
+        // Leftover bytes would corrupt the next response on this socket
+        http.getStream().stop();
+    }
+    return error;
+}
@@ -0,0 +1,114 @@
+#include "icon_pack.h"
+
+struct IconPackEntry {
+    uint8_t width, height;
+    uint16_t offset;   // First RLE byte in ICON_PACK_DATA
+};
+
+#include "icon_pack_data.h"
+
+static_assert(sizeof(ICON_PACK_INDEX) / sizeof(ICON_PACK_INDEX[0]) == ICON_COUNT - 1,
+              "icon pack out of step with IconId, regenerate it with tools/icon_pack.py");
+
+static const int MAX_ICON_PIXELS = 50 * 50;
+static uint16_t pixels[MAX_ICON_PIXELS];   // Decoded icon in the byte order the target expects
+
+// Counters for the "stats" serial command
+static unsigned long drawCount = 0;
+static unsigned long pixelsDecoded = 0;
+
+IconId iconFromWeatherCode(const String &code) {
+    if (code.length() != 3) {
+        return ICON_NONE;
+    }
+    bool night = code[2] == 'n';
+    switch (code.substring(0, 2).toInt()) {
+        case 1: return night ? ICON_CLEAR_NIGHT : ICON_CLEAR_DAY;
+        case 2: return night ? ICON_FEW_CLOUDS_NIGHT : ICON_FEW_CLOUDS_DAY;
+        case 3:
+        case 4: return ICON_CLOUDS;
+        case 9:
+        case 10: return ICON_RAIN;
+        case 11: return ICON_THUNDERSTORM;
+        case 13: return ICON_SNOW;
+        case 50: return ICON_MIST;
+    }
+    return ICON_NONE;
+}
+
+int iconWidth(IconId icon) {
+    return (icon > ICON_NONE && icon < ICON_COUNT) ? ICON_PACK_INDEX[icon - 1].width : 0;
+}
+
+int iconHeight(IconId icon) {
+    return (icon > ICON_NONE && icon < ICON_COUNT) ? ICON_PACK_INDEX[icon - 1].height : 0;
+}
+
+static uint16_t swapped(uint16_t color) {
+    return (color >> 8) | (color << 8);
+}
+
+// Decode icon into pixels and return its pack entry, or NULL for ICON_NONE. The
+// panel and 16-bit sprites take pixels byte swapped (swapBytes is off); 8-bit
+// sprites convert from plain RGB565. The caller pushes the pixels itself:
+// pushImage() is not virtual, so it has to be called on the target's own type
+// or a sprite's pixels would go to the panel instead of its buffer.
+static const IconPackEntry *decode(IconId icon, uint16_t tint, uint16_t background, bool swap) {
+    if (icon <= ICON_NONE || icon >= ICON_COUNT) {
+        return NULL;
+    }
+    const IconPackEntry &entry = ICON_PACK_INDEX[icon - 1];
+    uint16_t palette[sizeof(ICON_PACK_PALETTE) / sizeof(ICON_PACK_PALETTE[0])];
+    for (unsigned int i = 0; i < sizeof(palette) / sizeof(palette[0]); i++) {
+        palette[i] = ICON_PACK_PALETTE[i];
+    }
+    palette[0] = background;
+    palette[1] = tint;
+    if (swap) {
+        for (unsigned int i = 0; i < sizeof(palette) / sizeof(palette[0]); i++) {
+            palette[i] = swapped(palette[i]);
+        }
+    }
+
+    int count = entry.width * entry.height;
+    const uint8_t *data = ICON_PACK_DATA + entry.offset;
+    for (int i = 0; i < count;) {
+        uint8_t code = pgm_read_byte(data++);
+        uint16_t color = palette[code >> 4];
+        for (int run = (code & 0x0F) + 1; run > 0 && i < count; run--) {
+            pixels[i++] = color;
+        }
+    }
+    drawCount++;
+    pixelsDecoded += count;
+    return &entry;
+}
+
+void iconDraw(TFT_eSPI &out, IconId icon, int x, int y, uint16_t tint, uint16_t background) {
+    const IconPackEntry *entry = decode(icon, tint, background, true);
+    if (entry != NULL) {
+        out.pushImage(x, y, entry->width, entry->height, pixels);
+    }
+}
+
+void iconDraw(TFT_eSprite &out, IconId icon, int x, int y, uint16_t tint, uint16_t background) {
+    const IconPackEntry *entry = decode(icon, tint, background, out.getColorDepth() == 16);
+    if (entry != NULL) {
+        out.pushImage(x, y, entry->width, entry->height, pixels);  // TFT_eSprite::pushImage: into the buffer
+    }
+}
+
+bool iconPackSelfTest(TFT_eSprite &canvas) {
+    int size = iconWidth(ICON_STATUS_FULL);
+    if (canvas.width() < size || canvas.height() < size) {
+        return false;
+    }
+    // White and black survive the 8-bit canvas unchanged, so both depths compare exactly
+    iconDraw(canvas, ICON_STATUS_FULL, 0, 0, TFT_WHITE, TFT_BLACK);
+    return canvas.readPixel(size / 2, size / 2) == TFT_WHITE && canvas.readPixel(0, 0) == TFT_BLACK;
+}
+
+void iconPackPrintStats() {
+    Serial.println("Icons: " + String(drawCount) + " drawn, " + String(pixelsDecoded) + " pixels decoded from a " +
+                   String(sizeof(ICON_PACK_DATA)) + " byte pack");
+}
@@ -0,0 +1,147 @@
+// Generated by tools/icon_pack.py; edit the shapes there and regenerate.
+
+const uint16_t ICON_PACK_PALETTE[] = {
+    0x0000, 0xFFFF, 0xFFE0, 0xC618, 0x7BEF, 0x001F, 0x39E7, 0xFFFF,
+};
+
+const IconPackEntry ICON_PACK_INDEX[] = {
+    {50, 50, 0},    // clear day
+    {50, 50, 196},  // clear night
+    {50, 50, 398},  // few clouds, day
+    {50, 50, 604},  // few clouds, night
+    {50, 50, 811},  // clouds
+    {50, 50, 1005}, // rain
+    {50, 50, 1219}, // thunderstorm
+    {50, 50, 1430}, // snow
+    {50, 50, 1644}, // mist
+    {11, 11, 1818}, // status: full
+    {11, 11, 1839}, // status: half
+    {11, 11, 1876}, // status: empty
+    {14, 14, 1913}, // printer
+};
+
+const uint8_t ICON_PACK_DATA[] PROGMEM = {   // 1963 bytes
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x26, 0x0F, 0x0F, 0x07, 0x2C, 0x0F, 0x0F, 0x01, 0x2F, 0x22, 0x0F, 0x0D, 0x2F, 0x24, 0x0F,
+    0x0A, 0x2F, 0x28, 0x0F, 0x07, 0x2F, 0x2A, 0x0F, 0x05, 0x2F, 0x2C, 0x0F, 0x03, 0x2F, 0x2E, 0x0F,
+    0x01, 0x2F, 0x2F, 0x20, 0x0F, 0x00, 0x2F, 0x2F, 0x20, 0x0F, 0x2F, 0x2F, 0x22, 0x0D, 0x2F, 0x2F,
+    0x24, 0x0C, 0x2F, 0x2F, 0x24, 0x0C, 0x2F, 0x2F, 0x24, 0x0B, 0x2F, 0x2F, 0x26, 0x0A, 0x2F, 0x2F,
+    0x26, 0x0A, 0x2F, 0x2F, 0x26, 0x09, 0x2F, 0x2F, 0x28, 0x08, 0x2F, 0x2F, 0x28, 0x08, 0x2F, 0x2F,
+    0x28, 0x08, 0x2F, 0x2F, 0x28, 0x08, 0x2F, 0x2F, 0x28, 0x08, 0x2F, 0x2F, 0x28, 0x08, 0x2F, 0x2F,
+    0x28, 0x09, 0x2F, 0x2F, 0x26, 0x0A, 0x2F, 0x2F, 0x26, 0x0A, 0x2F, 0x2F, 0x26, 0x0B, 0x2F, 0x2F,
+    0x24, 0x0C, 0x2F, 0x2F, 0x24, 0x0C, 0x2F, 0x2F, 0x24, 0x0D, 0x2F, 0x2F, 0x22, 0x0F, 0x2F, 0x2F,
+    0x20, 0x0F, 0x00, 0x2F, 0x2F, 0x20, 0x0F, 0x01, 0x2F, 0x2E, 0x0F, 0x03, 0x2F, 0x2C, 0x0F, 0x05,
+    0x2F, 0x2A, 0x0F, 0x07, 0x2F, 0x28, 0x0F, 0x0A, 0x2F, 0x24, 0x0F, 0x0D, 0x2F, 0x22, 0x0F, 0x0F,
+    0x01, 0x2C, 0x0F, 0x0F, 0x07, 0x26, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x22, 0x0F, 0x0F, 0x0B, 0x24, 0x0F, 0x0F,
+    0x0A, 0x25, 0x0F, 0x0F, 0x09, 0x26, 0x0F, 0x0F, 0x09, 0x27, 0x0F, 0x0F, 0x07, 0x28, 0x0F, 0x0F,
+    0x07, 0x29, 0x0F, 0x0F, 0x07, 0x29, 0x0F, 0x0F, 0x06, 0x29, 0x0F, 0x0F, 0x06, 0x2A, 0x0F, 0x0F,
+    0x06, 0x2A, 0x0F, 0x0F, 0x05, 0x2B, 0x0F, 0x0F, 0x05, 0x2B, 0x0F, 0x0F, 0x04, 0x2D, 0x0F, 0x0F,
+    0x03, 0x2D, 0x0F, 0x0F, 0x03, 0x2D, 0x0F, 0x0F, 0x02, 0x2F, 0x0F, 0x0F, 0x01, 0x2F, 0x0F, 0x0F,
+    0x01, 0x2F, 0x20, 0x0F, 0x0F, 0x00, 0x2F, 0x21, 0x0F, 0x0F, 0x2F, 0x22, 0x0F, 0x02, 0x20, 0x0A,
+    0x2F, 0x23, 0x0F, 0x00, 0x21, 0x0A, 0x2F, 0x24, 0x0E, 0x22, 0x0B, 0x2F, 0x25, 0x0A, 0x23, 0x0C,
+    0x2F, 0x28, 0x04, 0x26, 0x0C, 0x2F, 0x2F, 0x24, 0x0D, 0x2F, 0x2F, 0x22, 0x0E, 0x2F, 0x2F, 0x22,
+    0x0F, 0x2F, 0x2F, 0x20, 0x0F, 0x00, 0x2F, 0x2F, 0x20, 0x0F, 0x01, 0x2F, 0x2E, 0x0F, 0x03, 0x2F,
+    0x2C, 0x0F, 0x04, 0x2F, 0x2C, 0x0F, 0x05, 0x2F, 0x2A, 0x0F, 0x08, 0x2F, 0x26, 0x0F, 0x0B, 0x2F,
+    0x24, 0x0F, 0x0E, 0x2F, 0x20, 0x0F, 0x0F, 0x02, 0x2C, 0x0F, 0x0F, 0x07, 0x26, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x06,
+    0x24, 0x0F, 0x0F, 0x09, 0x2A, 0x0F, 0x0F, 0x05, 0x2C, 0x0F, 0x0F, 0x02, 0x2F, 0x20, 0x0F, 0x0F,
+    0x2F, 0x22, 0x0F, 0x0E, 0x2F, 0x22, 0x0F, 0x0D, 0x2F, 0x24, 0x0F, 0x0B, 0x2F, 0x26, 0x0F, 0x0A,
+    0x2F, 0x26, 0x0F, 0x0A, 0x2F, 0x26, 0x0F, 0x09, 0x20, 0x34, 0x2F, 0x22, 0x0F, 0x06, 0x3A, 0x2F,
+    0x0F, 0x04, 0x3E, 0x2D, 0x0F, 0x02, 0x3F, 0x32, 0x2B, 0x0F, 0x01, 0x3F, 0x34, 0x2A, 0x0F, 0x00,
+    0x3F, 0x36, 0x28, 0x0F, 0x00, 0x3F, 0x38, 0x27, 0x0F, 0x00, 0x3F, 0x38, 0x27, 0x0F, 0x3F, 0x3A,
+    0x25, 0x0F, 0x00, 0x3F, 0x3A, 0x24, 0x0F, 0x00, 0x3F, 0x3C, 0x23, 0x0F, 0x00, 0x3F, 0x3C, 0x22,
+    0x0F, 0x01, 0x3F, 0x3C, 0x20, 0x0F, 0x02, 0x3F, 0x3E, 0x0F, 0x02, 0x3F, 0x3E, 0x0F, 0x02, 0x3F,
+    0x3E, 0x0F, 0x02, 0x3F, 0x3E, 0x0F, 0x01, 0x3F, 0x3F, 0x0F, 0x01, 0x3F, 0x3E, 0x0F, 0x02, 0x3F,
+    0x3E, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3C, 0x0F, 0x05, 0x3F, 0x3B, 0x0F, 0x06, 0x3F,
+    0x39, 0x0F, 0x08, 0x3F, 0x38, 0x0F, 0x09, 0x3F, 0x36, 0x0F, 0x0B, 0x3F, 0x34, 0x0F, 0x0D, 0x3F,
+    0x32, 0x0F, 0x0F, 0x00, 0x3E, 0x0F, 0x0F, 0x04, 0x3A, 0x0F, 0x0F, 0x09, 0x34, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x21, 0x0F, 0x0F, 0x0C, 0x23, 0x0F, 0x0F, 0x0B,
+    0x25, 0x0F, 0x0F, 0x0A, 0x25, 0x0F, 0x0F, 0x0A, 0x26, 0x0F, 0x0F, 0x09, 0x26, 0x0F, 0x0F, 0x09,
+    0x27, 0x0F, 0x0F, 0x08, 0x28, 0x0F, 0x0F, 0x08, 0x28, 0x0F, 0x0F, 0x07, 0x29, 0x0F, 0x0F, 0x07,
+    0x2A, 0x0F, 0x0F, 0x06, 0x2A, 0x0F, 0x0F, 0x05, 0x22, 0x34, 0x24, 0x0F, 0x0F, 0x04, 0x3A, 0x21,
+    0x0F, 0x0F, 0x02, 0x3E, 0x20, 0x0F, 0x0F, 0x3F, 0x32, 0x0C, 0x20, 0x0F, 0x3F, 0x34, 0x20, 0x08,
+    0x22, 0x0E, 0x3F, 0x36, 0x21, 0x04, 0x23, 0x0E, 0x3F, 0x38, 0x29, 0x0E, 0x3F, 0x38, 0x29, 0x0D,
+    0x3F, 0x3A, 0x27, 0x0E, 0x3F, 0x3A, 0x27, 0x0D, 0x3F, 0x3C, 0x25, 0x0E, 0x3F, 0x3C, 0x24, 0x0F,
+    0x3F, 0x3C, 0x23, 0x0F, 0x3F, 0x3E, 0x21, 0x0F, 0x00, 0x3F, 0x3E, 0x20, 0x0F, 0x01, 0x3F, 0x3E,
+    0x0F, 0x02, 0x3F, 0x3E, 0x0F, 0x01, 0x3F, 0x3F, 0x0F, 0x01, 0x3F, 0x3E, 0x0F, 0x02, 0x3F, 0x3E,
+    0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3C, 0x0F, 0x05, 0x3F, 0x3B, 0x0F, 0x06, 0x3F, 0x39,
+    0x0F, 0x08, 0x3F, 0x38, 0x0F, 0x09, 0x3F, 0x36, 0x0F, 0x0B, 0x3F, 0x34, 0x0F, 0x0D, 0x3F, 0x32,
+    0x0F, 0x0F, 0x00, 0x3E, 0x0F, 0x0F, 0x04, 0x3A, 0x0F, 0x0F, 0x09, 0x34, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x46, 0x0F, 0x0F, 0x07,
+    0x4C, 0x0F, 0x0F, 0x01, 0x4F, 0x42, 0x0F, 0x0D, 0x4F, 0x44, 0x0F, 0x0A, 0x4F, 0x48, 0x0F, 0x07,
+    0x4F, 0x4A, 0x0F, 0x04, 0x4F, 0x4D, 0x0F, 0x01, 0x4F, 0x4F, 0x40, 0x0E, 0x4F, 0x4F, 0x43, 0x0C,
+    0x4F, 0x4F, 0x44, 0x0B, 0x4F, 0x4F, 0x46, 0x09, 0x4F, 0x4F, 0x48, 0x08, 0x4F, 0x4F, 0x48, 0x07,
+    0x4F, 0x4F, 0x49, 0x07, 0x4F, 0x4F, 0x4A, 0x05, 0x4F, 0x4F, 0x4B, 0x05, 0x4F, 0x4F, 0x4B, 0x05,
+    0x4F, 0x4F, 0x4C, 0x03, 0x4F, 0x4F, 0x4D, 0x03, 0x4F, 0x4F, 0x4D, 0x03, 0x4F, 0x4F, 0x4D, 0x03,
+    0x4F, 0x4F, 0x4D, 0x03, 0x4F, 0x4F, 0x4D, 0x04, 0x4F, 0x4F, 0x4C, 0x04, 0x4F, 0x4F, 0x4B, 0x05,
+    0x4F, 0x4F, 0x4B, 0x06, 0x4F, 0x4F, 0x4A, 0x06, 0x4F, 0x4F, 0x49, 0x08, 0x4F, 0x4F, 0x48, 0x08,
+    0x4F, 0x4F, 0x48, 0x09, 0x4F, 0x4F, 0x46, 0x0B, 0x4F, 0x4F, 0x44, 0x0D, 0x4F, 0x4F, 0x43, 0x0F,
+    0x4F, 0x4F, 0x40, 0x0F, 0x02, 0x4F, 0x4D, 0x0F, 0x05, 0x4F, 0x4A, 0x0F, 0x07, 0x4F, 0x48, 0x0F,
+    0x0A, 0x4F, 0x44, 0x0F, 0x0D, 0x4F, 0x42, 0x0F, 0x0F, 0x01, 0x4C, 0x0F, 0x0F, 0x07, 0x46, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x54,
+    0x0F, 0x0F, 0x09, 0x5A, 0x0F, 0x0F, 0x04, 0x5E, 0x0F, 0x0F, 0x00, 0x5F, 0x52, 0x0F, 0x0D, 0x5F,
+    0x54, 0x0F, 0x0B, 0x5F, 0x56, 0x0F, 0x09, 0x5F, 0x58, 0x0F, 0x08, 0x5F, 0x58, 0x0F, 0x07, 0x5F,
+    0x5A, 0x0F, 0x06, 0x5F, 0x5A, 0x0F, 0x05, 0x5F, 0x5C, 0x0F, 0x04, 0x5F, 0x5C, 0x0F, 0x04, 0x5F,
+    0x5C, 0x0F, 0x03, 0x5F, 0x5E, 0x0F, 0x02, 0x5F, 0x5E, 0x0F, 0x02, 0x5F, 0x5E, 0x0F, 0x02, 0x5F,
+    0x5E, 0x0F, 0x02, 0x5F, 0x5E, 0x0F, 0x03, 0x5F, 0x5C, 0x0F, 0x04, 0x5F, 0x5C, 0x0F, 0x04, 0x5F,
+    0x5C, 0x0F, 0x05, 0x5F, 0x5A, 0x0F, 0x06, 0x5F, 0x5A, 0x0F, 0x07, 0x5F, 0x58, 0x0F, 0x08, 0x5F,
+    0x58, 0x0F, 0x09, 0x5F, 0x56, 0x0F, 0x0B, 0x5F, 0x54, 0x0F, 0x0D, 0x5F, 0x52, 0x0F, 0x0F, 0x00,
+    0x5E, 0x0F, 0x0F, 0x02, 0x50, 0x00, 0x5A, 0x0F, 0x0F, 0x03, 0x50, 0x03, 0x55, 0x0F, 0x0F, 0x06,
+    0x50, 0x03, 0x50, 0x03, 0x50, 0x0F, 0x0F, 0x05, 0x50, 0x03, 0x50, 0x03, 0x50, 0x0F, 0x0F, 0x06,
+    0x50, 0x03, 0x50, 0x03, 0x50, 0x0F, 0x0F, 0x05, 0x50, 0x03, 0x50, 0x03, 0x50, 0x0F, 0x0F, 0x06,
+    0x50, 0x03, 0x50, 0x03, 0x50, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x09, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x64, 0x0F, 0x0F, 0x09, 0x6A, 0x0F, 0x0F, 0x04, 0x6E, 0x0F, 0x0F,
+    0x00, 0x6F, 0x62, 0x0F, 0x0D, 0x6F, 0x64, 0x0F, 0x0B, 0x6F, 0x66, 0x0F, 0x09, 0x6F, 0x68, 0x0F,
+    0x08, 0x6F, 0x68, 0x0F, 0x07, 0x6F, 0x6A, 0x0F, 0x06, 0x6F, 0x6A, 0x0F, 0x05, 0x6F, 0x6C, 0x0F,
+    0x04, 0x6F, 0x6C, 0x0F, 0x04, 0x6F, 0x6C, 0x0F, 0x03, 0x6F, 0x6E, 0x0F, 0x02, 0x6F, 0x6E, 0x0F,
+    0x02, 0x6F, 0x6E, 0x0F, 0x02, 0x6F, 0x6E, 0x0F, 0x02, 0x6F, 0x6E, 0x0F, 0x03, 0x6F, 0x6C, 0x0F,
+    0x04, 0x6F, 0x6C, 0x0F, 0x04, 0x6F, 0x6C, 0x0F, 0x05, 0x6F, 0x6A, 0x0F, 0x06, 0x6F, 0x6A, 0x0F,
+    0x07, 0x6F, 0x68, 0x0F, 0x08, 0x6F, 0x68, 0x0F, 0x09, 0x65, 0x20, 0x6F, 0x0F, 0x0B, 0x65, 0x20,
+    0x6D, 0x0F, 0x0D, 0x65, 0x20, 0x6B, 0x0F, 0x0F, 0x00, 0x64, 0x20, 0x68, 0x0F, 0x0F, 0x04, 0x63,
+    0x20, 0x65, 0x0F, 0x0F, 0x09, 0x61, 0x20, 0x61, 0x0F, 0x0F, 0x0F, 0x20, 0x0F, 0x0F, 0x0F, 0x01,
+    0x20, 0x0F, 0x0F, 0x0F, 0x01, 0x20, 0x0F, 0x0F, 0x0F, 0x01, 0x20, 0x0F, 0x0F, 0x0F, 0x01, 0x20,
+    0x0F, 0x0F, 0x0F, 0x20, 0x0F, 0x0F, 0x0F, 0x20, 0x0F, 0x0F, 0x0F, 0x20, 0x0F, 0x0F, 0x0F, 0x20,
+    0x0F, 0x0F, 0x0F, 0x20, 0x0F, 0x0F, 0x0F, 0x20, 0x0F, 0x0F, 0x0F, 0x20, 0x0F, 0x0F, 0x0F, 0x20,
+    0x0F, 0x0F, 0x0F, 0x20, 0x0F, 0x0B, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x74, 0x0F, 0x0F, 0x09, 0x7A, 0x0F, 0x0F, 0x04,
+    0x7E, 0x0F, 0x0F, 0x00, 0x7F, 0x72, 0x0F, 0x0D, 0x7F, 0x74, 0x0F, 0x0B, 0x7F, 0x76, 0x0F, 0x09,
+    0x7F, 0x78, 0x0F, 0x08, 0x7F, 0x78, 0x0F, 0x07, 0x7F, 0x7A, 0x0F, 0x06, 0x7F, 0x7A, 0x0F, 0x05,
+    0x7F, 0x7C, 0x0F, 0x04, 0x7F, 0x7C, 0x0F, 0x04, 0x7F, 0x7C, 0x0F, 0x03, 0x7F, 0x7E, 0x0F, 0x02,
+    0x7F, 0x7E, 0x0F, 0x02, 0x7F, 0x7E, 0x0F, 0x02, 0x7F, 0x7E, 0x0F, 0x02, 0x7F, 0x7E, 0x0F, 0x03,
+    0x7F, 0x7C, 0x0F, 0x04, 0x7F, 0x7C, 0x0F, 0x04, 0x7F, 0x7C, 0x0F, 0x05, 0x7F, 0x7A, 0x0F, 0x06,
+    0x7F, 0x7A, 0x0F, 0x07, 0x7F, 0x78, 0x0F, 0x08, 0x7F, 0x78, 0x0F, 0x09, 0x7F, 0x76, 0x0F, 0x0B,
+    0x7F, 0x74, 0x0F, 0x0D, 0x7F, 0x72, 0x0F, 0x0F, 0x00, 0x7E, 0x0F, 0x0F, 0x02, 0x70, 0x00, 0x7A,
+    0x0F, 0x0F, 0x03, 0x70, 0x03, 0x75, 0x0F, 0x0F, 0x06, 0x70, 0x03, 0x70, 0x03, 0x70, 0x0F, 0x0F,
+    0x05, 0x70, 0x03, 0x70, 0x03, 0x70, 0x0F, 0x0F, 0x06, 0x70, 0x03, 0x70, 0x03, 0x70, 0x0F, 0x0F,
+    0x05, 0x70, 0x03, 0x70, 0x03, 0x70, 0x0F, 0x0F, 0x06, 0x70, 0x03, 0x70, 0x03, 0x70, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x3F, 0x3D, 0x0F, 0x03,
+    0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03,
+    0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03,
+    0x3F, 0x3D, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0D, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F,
+    0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F,
+    0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x03, 0x3F, 0x3D, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x03, 0x12, 0x05, 0x16, 0x02, 0x18,
+    0x01, 0x18, 0x00, 0x1F, 0x1F, 0x10, 0x00, 0x18, 0x01, 0x18, 0x02, 0x16, 0x05, 0x12, 0x03, 0x03,
+    0x12, 0x05, 0x13, 0x00, 0x11, 0x02, 0x14, 0x02, 0x10, 0x01, 0x14, 0x02, 0x10, 0x00, 0x15, 0x03,
+    0x16, 0x03, 0x16, 0x03, 0x10, 0x00, 0x14, 0x02, 0x10, 0x01, 0x14, 0x02, 0x10, 0x02, 0x13, 0x00,
+    0x11, 0x05, 0x12, 0x03, 0x03, 0x12, 0x05, 0x11, 0x02, 0x11, 0x02, 0x10, 0x06, 0x10, 0x01, 0x10,
+    0x06, 0x10, 0x00, 0x10, 0x08, 0x11, 0x08, 0x11, 0x08, 0x10, 0x00, 0x10, 0x06, 0x10, 0x01, 0x10,
+    0x06, 0x10, 0x02, 0x11, 0x02, 0x11, 0x05, 0x12, 0x03, 0x0F, 0x03, 0x72, 0x08, 0x71, 0x12, 0x71,
+    0x05, 0x70, 0x16, 0x70, 0x03, 0x70, 0x18, 0x70, 0x02, 0x70, 0x18, 0x70, 0x01, 0x70, 0x1A, 0x70,
+    0x00, 0x70, 0x1A, 0x70, 0x00, 0x70, 0x1A, 0x70, 0x01, 0x70, 0x18, 0x70, 0x02, 0x70, 0x18, 0x70,
+    0x03, 0x70, 0x16, 0x70, 0x05, 0x71, 0x12, 0x71, 0x08, 0x72, 0x04,
+};
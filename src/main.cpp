@@ -1,10 +1,26 @@
 #include <TFT_eSPI.h>
+#include "esp_heap_caps.h"
 #include <WiFi.h>
 #include "esp_wifi.h"
 #include <HTTPClient.h> 
+#include "http_pool.h"  // Keep-alive connection pool used by the fetch worker
+#include "dns_cache.h"  // Host name cache so polls skip mDNS lookups
+#include "sse_client.h"  // Server-Sent Events push channel from the status server
+#include "ws_client.h"  // Moonraker WebSocket subscriptions
+#include "http_multi.h"  // Parallel printer polls
+#include "scheduler.h"  // Deadline-ordered fetch jobs
+#include "circuit_breaker.h"  // Fail fast while a host is down
+#include "snapshot.h"  // Last-known widget state for warm boot
+#include "wifi_link.h"  // Fast Wi-Fi rejoin from a cached AP and lease
+#include "civil_time.h"  // Local date and DST from the NTP clock
+#include "time_sync.h"  // Background SNTP with clock slewing
+#include "second_tick.h"  // Wall-clock aligned seconds ticks
+#include "screen_regions.h"  // Dirty-rectangle widget repaints
+#include "glyph_atlas.h"  // Pre-rendered clock digits
+#include "text_runs.h"  // Glyph-level diffs of status text
+#include "font_metrics.h"  // Cached font widths for centring and diffs
+#include "icon_pack.h"  // Weather and status icons in flash
 #include <ArduinoJson.h>  // Include the ArduinoJson library
-#include <NTPClient.h>
-#include <WiFiUdp.h>
 #include <math.h>  // For sin() function in animation
 #include "credentials.h"  // WiFi and API credentials (not in version control)
 
@@ -32,199 +48,23 @@
 #define TFT_BRIGHT_BLUE 0x001F    // Bright blue (R:0, G:0, B:31) - full blue
 #define TFT_BRIGHT_ORANGE 0xFD20  // Bright orange (similar to existing)
 
-// ============================================================================
-// POSITION MATRIX - Easy modification of all display element positions
-// ============================================================================
-// All positions in pixels (x, y) with (0,0) at top-left
-// Portrait mode: 240x320 (width x height)
-// Landscape mode: 320x240 (width x height)
-
-// Time display positions
-struct {
-    struct {
-        int x;        // Portrait: 48 (timeXPos 62 - 14 offset)
-        int y;        // Portrait: 10
-        int xOffset;  // Offset from base timeXPos: -14
-    } portrait;
-    struct {
-        int x;        // Landscape: 87 (timeXPos 62 + 25 offset)
-        int y;        // Landscape: 30 (moved down for spacing)
-        int xOffset;  // Offset from base timeXPos: +25
-    } landscape;
-} timePos = {
-    {48, 10, -14},   // portrait
-    {87, 30, 25}     // landscape (moved down 20px)
-};
-
-// Date display positions
-struct {
-    struct {
-        int y;        // Portrait: 60
-        int centered; // Portrait: centered (calculated dynamically)
-    } portrait;
-    struct {
-        int xOffset;  // Landscape: +40 from base dateXPos
-        int y;        // Landscape: 70 (moved down for spacing)
-        int centered; // Landscape: centered (calculated dynamically)
-    } landscape;
-} datePos = {
-    {60, 1},         // portrait (centered)
-    {40, 70, 1}      // landscape (moved down 20px)
-};
-
-// Stock display positions
-struct {
-    struct {
-        int x;        // Portrait: 5
-        int y;        // Portrait: 160
-    } portrait;
-    struct {
-        int x;        // Landscape: 5
-        int y;        // Landscape: 90 (moved down for spacing)
-    } landscape;
-} stockPos = {
-    {5, 160},        // portrait
-    {5, 90}          // landscape (moved down 20px)
-};
-
-// Weather text positions
-struct {
-    struct {
-        int x;        // Portrait: 5
-        int y;        // Portrait: 90 (first line)
-        int lineSpacing; // Portrait: 20 pixels between lines
-    } portrait;
-    struct {
-        int x;        // Landscape: 5
-        int y;        // Landscape: 115 (moved down for spacing)
-    } landscape;
-} weatherTextPos = {
-    {5, 90, 20},     // portrait
-    {5, 115}         // landscape (moved down 20px)
-};
-
-// Weather icon positions
-struct {
-    struct {
-        int x;        // Portrait: 190 (240 - 50 icon width)
-        int y;        // Portrait: 90
-    } portrait;
-    struct {
-        int x;        // Landscape: 265
-        int y;        // Landscape: 105 (moved down for spacing)
-    } landscape;
-} weatherIconPos = {
-    {190, 90},       // portrait
-    {265, 105}       // landscape (moved down 25px)
-};
-
-// Coffee machine positions
-struct {
-    struct {
-        int x;        // Portrait: 5 (text mode)
-        int y;        // Portrait: 180
-    } portrait;
-    struct {
-        int x;        // Landscape: 280 (icon mode)
-        int y;        // Landscape: 30 (moved down for spacing)
-    } landscape;
-} coffeePos = {
-    {5, 180},        // portrait
-    {280, 30}        // landscape (moved down 20px)
-};
-
-// Animation positions
-struct {
-    struct {
-        int x;        // Portrait: 150
-        int y;        // Portrait: 180
-        int width;    // Portrait: 90 (240 - 150)
-        int height;   // Portrait: 50
-    } portrait;
-    struct {
-        int x;        // Landscape: 223
-        int y;        // Landscape: 160
-        int width;    // Landscape: 120
-        int height;   // Landscape: 100
-    } landscape;
-} animationPos = {
-    {150, 230, 90, 50},  // portrait (original position restored)
-    {223, 160, 120, 100} // landscape (original position restored)
-};
-
-// Trail status positions (Y coordinates, X is always 0)
-struct {
-    struct {
-        int mombaY;      // Portrait: 205
-        int johnBryanY;   // Portrait: 225
-        int caesarCreekY; // Portrait: 245
-        int lineSpacing; // Portrait: 20 pixels
-    } portrait;
-    struct {
-        int mombaY;      // Landscape: 155 (moved down for spacing)
-        int johnBryanY;  // Landscape: 175 (moved down for spacing)
-        int caesarCreekY;// Landscape: 195 (moved down for spacing)
-        int lineSpacing;// Landscape: 20 pixels
-    } landscape;
-} trailPos = {
-    {195,215, 235, 20}, // portrait
-    {155, 175, 195, 20}  // landscape (moved down 20px each)
-};
-
-// Countdown timer positions (right bottom)
-struct {
-    struct {
-        int x;        // Portrait: right-aligned (calculated dynamically)
-        int y;        // Portrait: 300 (near bottom of 320px screen)
-    } portrait;
-    struct {
-        int x;        // Landscape: right-aligned (calculated dynamically)
-        int y;        // Landscape: 220 (near bottom of 240px screen)
-    } landscape;
-} countdownPos = {
-    {0, 280},        // portrait (x calculated dynamically)
-    {0, 180}         // landscape (x calculated dynamically)
-};
-
-// Printer status icon positions (small icons, top right area)
-struct {
-    struct {
-        int x1;       // Portrait: first printer icon X
-        int x2;       // Portrait: second printer icon X
-        int y;        // Portrait: Y position
-        int spacing;  // Portrait: spacing between icons
-    } portrait;
-    struct {
-        int x1;       // Landscape: first printer icon X
-        int x2;       // Landscape: second printer icon X
-        int y;        // Landscape: Y position
-        int spacing;  // Landscape: spacing between icons
-    } landscape;
-} printerPos = {
-    {200, 220, 5, 20},   // portrait (top right, small icons)
-    {280, 300, 5, 20}    // landscape (top right, small icons)
-};
-
-// Base positions (used as reference for calculations)
-int timeXPos = 62;  // Base time X position (centered for 320px width display)
-int dateXPos = 55;  // Base date X position (centered for date text)
-int stockXPos = 5;  // Stock X position (left-aligned)
-int weatherXPos = 5;  // Weather X position (left-aligned)
-int coffeeStatusXPos = 5;  // Coffee status X position (left-aligned)
-int trailStatusXPos = 0;  // Trail status X position (left edge)
-
 void setupNTP();
 
 // Forward declarations for display update functions
 void updateTimeDisplay();
-void updateWeatherDisplay();
-void updateStockDisplay();
-void updateCoffeeMachineDisplay();
-void updateTrailDisplay();
+void layoutWidgets();
+void flushScreen();
+void redrawMainScreen();
+void drawCoffeeWidget();
+void drawTrailWidget();
+void drawPrinterWidget();
+void drawStaleMarker();
 bool refreshAllTrails();  // Force server-side refresh (POST /api/trail/refresh)
-void updatePrinterDisplay();
+void printStockStats();
+void printPrinterLinkStats();
+void requestHealthReport();
+void printBootTimeline();
 void updateCountdownDisplay();
-void drawWeatherIconStatic();
 
 // TFT Display setup
 TFT_eSPI tft = TFT_eSPI();
@@ -237,20 +77,31 @@ const int serverPort = 5000;
 // API key loaded from credentials.h
 const char* alphaVantageHost = "www.alphavantage.co";
 
-// Timing variables
-unsigned long lastTimeUpdate = 0;
-unsigned long lastWeatherUpdate = 0;
-unsigned long lastCoffeeUpdate = 0;
-unsigned long lastTrailUpdate = 0;
-unsigned long lastStockUpdate = 0;
-unsigned long lastPrinterUpdate = 0;
-const unsigned long TIME_UPDATE_INTERVAL = 30000; // Update time every 30 seconds
+// Fetch intervals (scheduled by the fetch worker, see fetchJobs)
 const unsigned long WEATHER_UPDATE_INTERVAL = 1800000; // Update weather every 30 minutes
 const unsigned long COFFEE_UPDATE_INTERVAL = 300000; // Update coffee machine status every 5 minutes
 const unsigned long TRAIL_UPDATE_INTERVAL = 1800000; // Update trail status every 30 minutes (matches server cache)
 const unsigned long STOCK_UPDATE_INTERVAL = 300000; // Update stock price every 5 minutes
 const unsigned long PRINTER_UPDATE_INTERVAL = 30000; // Update printer status every 30 seconds
 
+// Fetch worker task and its queues (see FETCH WORKER section)
+QueueHandle_t fetchRequestQueue = NULL;  // loop() -> worker: FetchRequest
+QueueHandle_t fetchResultQueue = NULL;   // worker -> loop(): FetchResult*
+TaskHandle_t fetchWorkerHandle = NULL;
+TaskHandle_t loopTaskHandle = NULL;  // Woken by posted fetch results and seconds ticks
+
+// Change events pushed by the status server (see FETCH WORKER section)
+void handleServerEvent(const String &event, const String &data);
+SseClient serverEvents(serverHost, serverPort, "/api/events", handleServerEvent);
+
+// Outcome of a conditional GET: FETCH_NOT_MODIFIED means the server answered 304
+// and the caller's copy is still current, so there is nothing to parse or redraw
+enum FetchStatus {
+    FETCH_FAILED,
+    FETCH_UPDATED,
+    FETCH_NOT_MODIFIED
+};
+
 // Time structure
 struct TimeInfo {
     String time;
@@ -264,7 +115,7 @@ struct WeatherInfo {
     int temperature;
     int feels_like;
     int humidity;
-    String icon;
+    IconId icon;  // Parsed from the OpenWeatherMap code when fetched
 } currentWeather;
 
 // Forecast structure for today and tomorrow
@@ -273,7 +124,7 @@ struct ForecastDay {
     int high;
     int low;
     String conditions;
-    String icon;
+    IconId icon;
 };
 struct ForecastInfo {
     ForecastDay today;
@@ -311,7 +162,19 @@ struct PrinterInfo {
     String lastStatus;  // Track previous status to detect transitions
     bool isFlashing;  // Track if printer icon should flash
     unsigned long flashStartTime;  // When flashing started
-} sovolPrinter, mandrainPrinter;
+};
+
+// Moonraker printers, shown left to right in the top right corner
+struct PrinterConfig {
+    const char *name;
+    const char *host;
+};
+const PrinterConfig printerConfig[] = {
+    {"Sovol", "sovol.lan"},
+    {"Mandrain", "mandrainpi.lan"},
+};
+const int PRINTER_COUNT = sizeof(printerConfig) / sizeof(printerConfig[0]);
+PrinterInfo printers[PRINTER_COUNT];
 
 // Printer flash constants
 const unsigned long PRINTER_FLASH_DURATION = 10000; // Flash for 10 seconds
@@ -339,91 +202,306 @@ const unsigned long HOLD_THRESHOLD = 300;  // Hold for 300ms to trigger forecast
 // Add this near other global variables at the top
 bool needRedraw = true;  // Global variable for screen updates
 
-WiFiUDP ntpUDP;
-NTPClient timeClient(ntpUDP, "pool.ntp.org", -5 * 3600); // Default to EST (UTC-5), will adjust for DST automatically
-unsigned long lastSecondUpdate = 0;
-const unsigned long SECOND_UPDATE_INTERVAL = 1000; // Update seconds every 1 second
+const char *const NTP_SERVERS[TIME_SYNC_SERVER_COUNT] = {"pool.ntp.org", "time.google.com", "time.nist.gov"};
+const char *TIME_ZONE = "EST5EDT,M3.2.0,M11.1.0"; // POSIX TZ rule: US Eastern with DST
+const unsigned long INPUT_POLL_INTERVAL = 20;      // Longest loop() sleep; buttons are polled, not interrupt driven
 bool useLocalServerTime = false; // Use NTP directly (more efficient - no local server overhead)
-unsigned long lastDSTCheck = 0;
-const unsigned long DST_CHECK_INTERVAL = 3600000; // Check DST once per hour (offset changes are rare)
-int cachedDSTOffset = -5 * 3600; // Cache current DST offset
 
 // Add these with other global variables at the top
 static String lastTime = "";
 static String lastSeconds = "";
 static String lastDate = "";
-static String lastDisplayedDate = "";  // Track displayed date string to enable forced redraws
-static String lastStockDisplay = "";  // Cache last stock display to prevent disappearing
 static String lastCoffeeScheduledTime = "";  // Track last scheduled coffee time for auto-schedule
 static String lastCoffeeDisplayTime = "";  // Cache last displayed coffee time to prevent disappearing
-static String lastCoffeeStatus = "";  // Track coffee status to prevent unnecessary redraws
 static int lastCountdownDays = -1;  // Track last countdown value to prevent unnecessary redraws
 
-// Animation disabled - weather icon is drawn statically
-
-void drawWeatherIcon(String icon, int x, int y) {
-    // Clear the area where the icon will be drawn
-    tft.fillRect(x, y, 50, 50, BACKGROUND);
-
-    if (icon == "01d" || icon == "01n") {
-        // Clear sky
-        tft.fillCircle(x + 25, y + 25, 20, TFT_YELLOW);
-    } else if (icon == "02d" || icon == "02n") {
-        // Few clouds
-        tft.fillCircle(x + 25, y + 25, 20, TFT_LIGHTGREY);
-        tft.fillCircle(x + 15, y + 25, 15, TFT_LIGHTGREY);
-    } else if (icon == "03d" || icon == "03n" || icon == "04d" || icon == "04n") {
-        // Scattered or broken clouds
-        tft.fillCircle(x + 25, y + 25, 20, TFT_GREY);
-        tft.fillCircle(x + 15, y + 25, 15, TFT_GREY);
-    } else if (icon == "09d" || icon == "09n" || icon == "10d" || icon == "10n") {
-        // Rain
-        tft.fillCircle(x + 25, y + 20, 15, TFT_BLUE);
-        for (int i = 0; i < 3; i++) {
-            tft.drawLine(x + 20 + (i * 5), y + 30, x + 15 + (i * 5), y + 40, TFT_BLUE);
-        }
-    } else if (icon == "11d" || icon == "11n") {
-        // Thunderstorm
-        tft.fillCircle(x + 25, y + 20, 15, TFT_DARKGREY);
-        tft.drawLine(x + 20, y + 30, x + 30, y + 40, TFT_YELLOW);
-        tft.drawLine(x + 30, y + 40, x + 20, y + 50, TFT_YELLOW);
-    } else if (icon == "13d" || icon == "13n") {
-        // Snow
-        tft.fillCircle(x + 25, y + 20, 15, TFT_WHITE);
-        for (int i = 0; i < 3; i++) {
-            tft.drawLine(x + 20 + (i * 5), y + 30, x + 15 + (i * 5), y + 40, TFT_WHITE);
+// Off-screen widget composition. Each widget is drawn into this sprite with its
+// top left at (0, 0) and pushed to the panel in a single block write, so the
+// panel never shows a cleared but not yet redrawn widget, and a widget cannot
+// paint outside its own rectangle. One sprite sized for the largest widget is
+// shared by all of them; only the widget's part of it is pushed.
+TFT_eSprite canvas = TFT_eSprite(&tft);
+const int CANVAS_WIDTH = 320;   // Widest widget: full landscape width
+const int CANVAS_HEIGHT = 66;   // Tallest widget: three lines of font 2
+
+ScreenRect widgetRect;  // Panel rectangle of the widget being composed
+ScreenRect pushRect;    // Part of widgetRect that pushWidget() sends to the panel
+
+// Main screen widgets, in z-order for the region manager: where bounding boxes
+// overlap, the later widget is painted on top. layoutWidgets() gives each one
+// its box for the current rotation.
+enum ScreenWidget : uint8_t {
+    WIDGET_DATE,
+    WIDGET_TIME,
+    WIDGET_SECONDS,
+    WIDGET_STOCK,
+    WIDGET_WEATHER_TEXT,
+    WIDGET_COFFEE,
+    WIDGET_TRAILS,          // Full width, so above the coffee line it touches in portrait
+    WIDGET_WEATHER_ICON,    // Above the trail rows it reaches in landscape
+    WIDGET_PRINTERS,
+    WIDGET_STALE_MARKER,
+    WIDGET_COUNT
+};
+void markTextChanges(ScreenWidget id);
+
+// ============================================================================
+// LAYOUT - Widget boxes for every rotation, fixed at compile time
+// ============================================================================
+// All positions in pixels (x, y) with (0,0) at top-left. Rotations 0 and 2 use
+// the portrait table (240x320), 1 and 3 the landscape one (320x240). Each box
+// holds its widget's content at its drawn size, in ScreenWidget order. The
+// static_asserts below reject a table in which a box leaves the screen, is
+// larger than the canvas it is composed in, or overlaps another box, so a
+// layout mistake fails the build instead of leaving artifacts on the panel.
+// The countdown row is checked against the boxes too, unless the table hides it.
+struct ScreenLayout {
+    int16_t width, height;              // Screen size
+    bool landscape;
+    ScreenRect widgets[WIDGET_COUNT];
+    int16_t stockTextY;                 // Stock text below the top of its box
+    int16_t lineSpacing;                // Between weather (portrait) and trail lines
+    int16_t trailTextY;                 // First trail line below the top of its box
+    int16_t coffeeTextX, coffeeTextY;   // Coffee text in its box
+    int16_t printerSpacing;             // Per printer icon
+    int16_t countdownY;                 // Countdown row, drawn outside the region manager
+    bool countdownShown;                // false: the row overlaps a widget and the countdown is not drawn
+};
+
+// Box of w x h at (x, y), right after box on the same screen
+constexpr ScreenRect rightOf(const ScreenRect &box, int16_t y, int16_t w, int16_t h) {
+    return {(int16_t)(box.x + box.w), y, w, h};
+}
+
+// Right-aligned row of printer icons ending at x = right
+constexpr ScreenRect printerRow(int16_t right, int16_t y, int16_t spacing) {
+    return {(int16_t)(right - PRINTER_COUNT * spacing), y, (int16_t)(PRINTER_COUNT * spacing), 14};
+}
+
+// Font 4 at size 2 has a 52px cell; the time box keeps the 40px holding the digits
+constexpr ScreenRect PORTRAIT_TIME = {48, 10, 135, 40};
+constexpr ScreenRect LANDSCAPE_TIME = {87, 30, 135, 40};
+
+constexpr ScreenLayout PORTRAIT_LAYOUT = {
+    240, 320, false,
+    {
+        {0, 60, 240, 25},                       // Date: full width, centred
+        PORTRAIT_TIME,
+        rightOf(PORTRAIT_TIME, 20, 50, 30),     // Seconds
+        {5, 158, 235, 22},                      // Stock: 2px above the text
+        {5, 90, 185, 65},                       // Weather text: 3 lines left of the icon
+        {0, 180, 240, 16},                      // Coffee: one text line
+        {0, 196, 240, 62},                      // Trails: three lines, 2px above the first
+        {190, 90, 50, 50},                      // Weather icon
+        printerRow(240, 5, 20),
+        {2, 2, 7, 7},                           // Stale marker
+    },
+    2, 20, 2, 5, 0, 20, 280, true
+};
+
+constexpr ScreenLayout LANDSCAPE_LAYOUT = {
+    320, 240, true,
+    {
+        {0, 70, 320, 20},                       // Date: ends where the stock row starts
+        LANDSCAPE_TIME,
+        rightOf(LANDSCAPE_TIME, 35, 50, 30),    // Seconds
+        {5, 90, 255, 22},                       // Stock: up to the weather icon
+        {5, 115, 260, 20},                      // Weather text: one line
+        {278, 20, 42, 50},                      // Coffee: 40px icon, scheduled time under it
+        {0, 153, 320, 62},                      // Trails: three lines, 2px above the first
+        {265, 103, 50, 50},                     // Weather icon
+        printerRow(320, 5, 20),
+        {2, 2, 7, 7},                           // Stale marker
+    },
+    0, 20, 2, 2, 42, 20, 180, false    // Countdown hidden: no 35px row is free below the trails
+};
+
+constexpr const ScreenLayout *LAYOUTS[4] = {&PORTRAIT_LAYOUT, &LANDSCAPE_LAYOUT, &PORTRAIT_LAYOUT, &LANDSCAPE_LAYOUT};
+
+// Layout checks, written as single-return recursion so they stay C++11 constexpr
+constexpr bool rectFits(const ScreenLayout &layout, const ScreenRect &r) {
+    return r.x >= 0 && r.y >= 0 && r.w > 0 && r.h > 0 && r.x + r.w <= layout.width && r.y + r.h <= layout.height &&
+           r.w <= CANVAS_WIDTH && r.h <= CANVAS_HEIGHT;
+}
+
+constexpr bool rectsOverlap(const ScreenRect &a, const ScreenRect &b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+// Box i overlaps none of the boxes from j on
+constexpr bool overlapsNoneFrom(const ScreenLayout &layout, int i, int j) {
+    return j >= WIDGET_COUNT ||
+           (!rectsOverlap(layout.widgets[i], layout.widgets[j]) && overlapsNoneFrom(layout, i, j + 1));
+}
+
+constexpr bool layoutValidFrom(const ScreenLayout &layout, int i) {
+    return i >= WIDGET_COUNT ||
+           (rectFits(layout, layout.widgets[i]) && overlapsNoneFrom(layout, i, i + 1) && layoutValidFrom(layout, i + 1));
+}
+
+static_assert(layoutValidFrom(PORTRAIT_LAYOUT, 0), "portrait layout: widget box off screen, too large or overlapping");
+static_assert(layoutValidFrom(LANDSCAPE_LAYOUT, 0), "landscape layout: widget box off screen, too large or overlapping");
+// Area updateCountdownDisplay() clears: right-aligned text ending 60px from the right edge
+constexpr ScreenRect countdownRow(const ScreenLayout &layout) {
+    return {0, layout.countdownY, (int16_t)(layout.width - 60), 35};
+}
+
+// The countdown row overlaps none of the widget boxes from j on
+constexpr bool countdownClearFrom(const ScreenLayout &layout, int j) {
+    return j >= WIDGET_COUNT ||
+           (!rectsOverlap(countdownRow(layout), layout.widgets[j]) && countdownClearFrom(layout, j + 1));
+}
+
+static_assert(PORTRAIT_LAYOUT.countdownY + 35 <= PORTRAIT_LAYOUT.height, "portrait countdown below the screen");
+static_assert(LANDSCAPE_LAYOUT.countdownY + 35 <= LANDSCAPE_LAYOUT.height, "landscape countdown below the screen");
+static_assert(!PORTRAIT_LAYOUT.countdownShown || countdownClearFrom(PORTRAIT_LAYOUT, 0),
+              "portrait countdown overlaps a widget box");
+static_assert(!LANDSCAPE_LAYOUT.countdownShown || countdownClearFrom(LANDSCAPE_LAYOUT, 0),
+              "landscape countdown overlaps a widget box");
+
+// Layout of the current rotation
+const ScreenLayout &screenLayout() {
+    return *LAYOUTS[currentRotation & 3];
+}
+
+// DMA pushes. A composed widget is copied out of the canvas in bands of
+// DMA_BAND_LINES rows into two DMA-capable buffers in turn, and each band is
+// handed to the SPI DMA engine with pushImageDMA(). A band is copied while the
+// previous one is still being sent, and once the last band is queued the
+// canvas is free to compose the next widget during the transfer. DMA is only
+// used inside a display batch, which holds the SPI bus and waits for the last
+// transfer before releasing it; outside one, and with an 8-bit canvas, widgets
+// are pushed with blocking writes.
+const int DMA_BAND_LINES = 16;   // 10KB per buffer at full landscape width
+uint16_t *dmaBands[2] = {NULL, NULL};
+int dmaNextBand = 0;
+bool dmaReady = false;
+bool displayBatchOpen = false;
+
+// Counters for the "stats" serial command
+unsigned long dmaBandsPushed = 0;
+unsigned long blockingPushes = 0;
+unsigned long lastFullRedrawUs = 0;
+
+// Allocate the shared sprite once, before the heap fragments. 16-bit colour
+// needs 41KB; fall back to 8-bit if that does not fit.
+void createCanvas() {
+    canvas.setColorDepth(16);
+    if (canvas.createSprite(CANVAS_WIDTH, CANVAS_HEIGHT) == NULL) {
+        canvas.setColorDepth(8);
+        if (canvas.createSprite(CANVAS_WIDTH, CANVAS_HEIGHT) == NULL) {
+            Serial.println("No memory for the widget canvas, widgets will not be drawn");
+            return;
         }
-    } else if (icon == "50d" || icon == "50n") {
-        // Mist
-        tft.fillRect(x + 10, y + 20, 30, 10, TFT_LIGHTGREY);
-        tft.fillRect(x + 10, y + 35, 30, 10, TFT_LIGHTGREY);
     }
+    Serial.println("Widget canvas: " + String(CANVAS_WIDTH) + "x" + String(CANVAS_HEIGHT) + ", " +
+                   String(canvas.getColorDepth()) + "-bit");
+
+    // The DMA buffers hold panel-ordered 16-bit pixels copied straight from the canvas
+    if (canvas.getColorDepth() != 16) {
+        return;
+    }
+    size_t bandBytes = CANVAS_WIDTH * DMA_BAND_LINES * sizeof(uint16_t);
+    dmaBands[0] = (uint16_t *)heap_caps_malloc(bandBytes, MALLOC_CAP_DMA);
+    dmaBands[1] = (uint16_t *)heap_caps_malloc(bandBytes, MALLOC_CAP_DMA);
+    if (dmaBands[0] == NULL || dmaBands[1] == NULL || !tft.initDMA()) {
+        heap_caps_free(dmaBands[0]);
+        heap_caps_free(dmaBands[1]);
+        dmaBands[0] = dmaBands[1] = NULL;
+        Serial.println("SPI DMA unavailable, widgets are pushed with blocking writes");
+        return;
+    }
+    dmaReady = true;
 }
 
-// Draw weather icon statically (animation disabled)
-void drawWeatherIconStatic() {
-    // Only draw if we have weather data
-    if (currentWeather.icon.length() == 0) {
+// Open a batch of widget pushes that may overlap their transfers with drawing
+void beginDisplayBatch() {
+    if (dmaReady) {
+        tft.startWrite();
+    }
+    displayBatchOpen = true;
+}
+
+// Wait for the last transfer, so the panel is up to date and the bus is free
+void endDisplayBatch() {
+    if (dmaReady) {
+        tft.dmaWait();
+        tft.endWrite();
+    }
+    displayBatchOpen = false;
+}
+
+// Clock digits: HH:MM in font 4 at size 2, seconds in font 4 at size 1
+GlyphAtlas timeGlyphs = {};
+GlyphAtlas secondsGlyphs = {};
+
+// Render the clock glyphs once; without them the clock falls back to drawString()
+void buildClockGlyphs() {
+    if (!glyphAtlasBuild(timeGlyphs, tft, 4, 2) || !glyphAtlasBuild(secondsGlyphs, tft, 4, 1)) {
+        Serial.println("No memory for the clock glyphs, drawing the clock from the font");
+    }
+}
+
+void printDisplayStats() {
+    Serial.println("Display: " + String(dmaReady ? "DMA" : "no DMA") + ", " + String(dmaBandsPushed) + " DMA bands, " +
+                   String(blockingPushes) + " blocking pushes, last full redraw " +
+                   String(lastFullRedrawUs / 1000.0, 1) + "ms");
+}
+
+// Start composing the widget covering (x, y, w, h) on the panel. Draw into the
+// returned sprite relative to the widget's top left, then call pushWidget().
+TFT_eSprite &beginWidget(int x, int y, int w, int h) {
+    widgetRect = {(int16_t)x, (int16_t)y, (int16_t)min(w, CANVAS_WIDTH), (int16_t)min(h, CANVAS_HEIGHT)};
+    pushRect = widgetRect;
+    canvas.fillRect(0, 0, widgetRect.w, widgetRect.h, BACKGROUND);
+    return canvas;
+}
+
+// Start composing a registered widget over its whole bounding box. Only the
+// part the region manager reports dirty is pushed.
+TFT_eSprite &beginWidget(ScreenWidget id) {
+    const ScreenRect &bounds = regionBounds(id);
+    beginWidget(bounds.x, bounds.y, bounds.w, bounds.h);
+    ScreenRect damage = regionIntersection(regionDamage(), widgetRect);
+    if (damage.w > 0 && damage.h > 0) {
+        pushRect = damage;
+    }
+    return canvas;
+}
+
+void pushWidget() {
+    // Canvas coordinates of the part being pushed
+    int sourceX = pushRect.x - widgetRect.x;
+    int sourceY = pushRect.y - widgetRect.y;
+    if (!dmaReady || !displayBatchOpen) {
+        canvas.pushSprite(pushRect.x, pushRect.y, sourceX, sourceY, pushRect.w, pushRect.h);
+        blockingPushes++;
         return;
     }
-    
-    // Get weather icon position
-    int iconX, iconY;
-    if (currentRotation == 1 || currentRotation == 3) { // Landscape
-        iconX = weatherIconPos.landscape.x;
-        iconY = weatherIconPos.landscape.y;
-    } else { // Portrait
-        iconX = weatherIconPos.portrait.x;
-        iconY = weatherIconPos.portrait.y;
+    const uint16_t *pixels = (const uint16_t *)canvas.getPointer() + sourceY * CANVAS_WIDTH + sourceX;
+    for (int row = 0; row < pushRect.h; row += DMA_BAND_LINES) {
+        int lines = min(DMA_BAND_LINES, pushRect.h - row);
+        // pushImageDMA() waits for one transfer before queueing the next, so the
+        // one in flight reads the other buffer and this one is free to fill
+        uint16_t *band = dmaBands[dmaNextBand];
+        dmaNextBand ^= 1;
+        for (int line = 0; line < lines; line++) {
+            memcpy(band + line * pushRect.w, pixels + (row + line) * CANVAS_WIDTH, pushRect.w * sizeof(uint16_t));
+        }
+        tft.pushImageDMA(pushRect.x, pushRect.y + row, pushRect.w, lines, band);
+        dmaBandsPushed++;
     }
-    
-    // Draw weather icon at static position
-    drawWeatherIcon(currentWeather.icon, iconX, iconY);
 }
 
-void drawCoffeeIcon(uint16_t color, int x, int y) {
-    // Clear the area where the icon will be drawn (only icon area, not time below)
-    tft.fillRect(x, y, 40, 40, BACKGROUND);
+// Draw weather icon statically (animation disabled)
+void drawWeatherIconWidget() {
+    TFT_eSprite &out = beginWidget(WIDGET_WEATHER_ICON);
+    // Nothing is drawn until there is weather data
+    iconDraw(out, currentWeather.icon, 0, 0, TEXT_COLOR, BACKGROUND);
+    pushWidget();
+}
+
+void drawCoffeeIcon(TFT_eSPI &out, uint16_t color, int x, int y) {
     
     // Draw a simple coffee cup icon using basic shapes
     // Cup body (rectangle/trapezoid shape)
@@ -435,28 +513,28 @@ void drawCoffeeIcon(uint16_t color, int x, int y) {
     // Fill cup entirely with color (no different interior color)
     if (color == TFT_GREEN) {
         // Fill entire cup with green - ALL GREEN, no orange
-        tft.fillRect(cupX, cupY, cupWidth, cupHeight, color);
+        out.fillRect(cupX, cupY, cupWidth, cupHeight, color);
         
         // Steam lines (3 curved lines above cup)
         for (int i = 0; i < 3; i++) {
             int steamX = cupX + 5 + (i * 6);
-            tft.drawLine(steamX, cupY - 2, steamX + 1, cupY - 4, TFT_WHITE);
-            tft.drawLine(steamX + 1, cupY - 4, steamX, cupY - 6, TFT_WHITE);
+            out.drawLine(steamX, cupY - 2, steamX + 1, cupY - 4, TFT_WHITE);
+            out.drawLine(steamX + 1, cupY - 4, steamX, cupY - 6, TFT_WHITE);
         }
     } else if (color == TFT_RED) {
         // Red (off) - fill cup solid red
-        tft.fillRect(cupX, cupY, cupWidth, cupHeight, color);
+        out.fillRect(cupX, cupY, cupWidth, cupHeight, color);
     } else if (color == TFT_YELLOW) {
         // Yellow (offline) - fill cup solid yellow
-        tft.fillRect(cupX, cupY, cupWidth, cupHeight, color);
+        out.fillRect(cupX, cupY, cupWidth, cupHeight, color);
         // Add warning X mark
         int warnX = x + 32;
         int warnY = y + 5;
-        tft.drawLine(warnX, warnY, warnX + 5, warnY + 5, TFT_BLACK);
-        tft.drawLine(warnX, warnY + 5, warnX + 5, warnY, TFT_BLACK);
+        out.drawLine(warnX, warnY, warnX + 5, warnY + 5, TFT_BLACK);
+        out.drawLine(warnX, warnY + 5, warnX + 5, warnY, TFT_BLACK);
     } else {
         // Default - outline only
-        tft.drawRect(cupX, cupY, cupWidth, cupHeight, color);
+        out.drawRect(cupX, cupY, cupWidth, cupHeight, color);
     }
     
     // Cup handle (always draw)
@@ -464,9 +542,9 @@ void drawCoffeeIcon(uint16_t color, int x, int y) {
     int handleY = cupY + 8;
     // Draw handle as curved lines
     uint16_t handleColor = (color == TFT_GREEN || color == TFT_RED || color == TFT_YELLOW) ? color : TFT_WHITE;
-    tft.drawLine(handleX, handleY, handleX + 3, handleY + 2, handleColor);
-    tft.drawLine(handleX + 3, handleY + 2, handleX + 3, handleY + 8, handleColor);
-    tft.drawLine(handleX + 3, handleY + 8, handleX, handleY + 10, handleColor);
+    out.drawLine(handleX, handleY, handleX + 3, handleY + 2, handleColor);
+    out.drawLine(handleX + 3, handleY + 2, handleX + 3, handleY + 8, handleColor);
+    out.drawLine(handleX + 3, handleY + 8, handleX, handleY + 10, handleColor);
 }
 
 uint16_t getTrailStatusColor(String status) {
@@ -498,276 +576,208 @@ uint16_t getPrinterStatusColor(String status) {
     return TFT_DARKGREY;   // Grey when offline or unknown
 }
 
-// Draw small printer status icon (12x12 pixel circle)
-void drawPrinterIcon(uint16_t color, int x, int y) {
-    // Clear the area
-    tft.fillRect(x, y, 14, 14, BACKGROUND);
-    // Draw filled circle for status
-    tft.fillCircle(x + 7, y + 7, 6, color);
-    // Draw outline for visibility
-    tft.drawCircle(x + 7, y + 7, 6, TFT_WHITE);
-}
-
-// Helper function to remove year from date string
-String removeYearFromDate(String dateStr) {
-    // Handle various date formats
-    // Format: "YYYY-MM-DD" -> "MM-DD"
-    if (dateStr.indexOf('-') == 4) {
-        // YYYY-MM-DD format, remove first 5 characters (YYYY-)
-        return dateStr.substring(5);
+// Mark the cells of the clock characters that differ between drawn and text.
+// Digits share one width, so when the cells line up only the changed span is
+// sent to the panel; anything else repaints the whole widget.
+void invalidateChangedGlyphs(ScreenWidget id, const GlyphAtlas &atlas, const String &drawn, const String &text) {
+    if (drawn.length() != text.length() || !glyphAtlasCovers(atlas, drawn) || !glyphAtlasCovers(atlas, text)) {
+        regionInvalidate(id);
+        return;
     }
-    // Format: "Month DD, YYYY" -> "Month DD"
-    int commaPos = dateStr.indexOf(',');
-    if (commaPos > 0) {
-        // Check if there's a 4-digit year after comma
-        String afterComma = dateStr.substring(commaPos + 1);
-        afterComma.trim();
-        if (afterComma.length() == 4 && afterComma.toInt() > 1900) {
-            return dateStr.substring(0, commaPos);
-        }
+    int first = 0;
+    while (first < (int)text.length() && drawn[first] == text[first]) {
+        first++;
     }
-    // Format: "DD/MM/YYYY" or "DD-MM-YYYY" -> "DD/MM" or "DD-MM"
-    int lastSlash = dateStr.lastIndexOf('/');
-    int lastDash = dateStr.lastIndexOf('-');
-    if (lastSlash > 0) {
-        String afterSlash = dateStr.substring(lastSlash + 1);
-        if (afterSlash.length() == 4 && afterSlash.toInt() > 1900) {
-            return dateStr.substring(0, lastSlash);
-        }
+    if (first == (int)text.length()) {
+        return;
     }
-    if (lastDash > 0 && dateStr.indexOf('-') != lastDash) {
-        String afterDash = dateStr.substring(lastDash + 1);
-        if (afterDash.length() == 4 && afterDash.toInt() > 1900) {
-            return dateStr.substring(0, lastDash);
-        }
+    int last = text.length() - 1;
+    while (drawn[last] == text[last]) {
+        last--;
+    }
+    int left = glyphAtlasTextWidth(atlas, text, first);
+    int right = glyphAtlasTextWidth(atlas, text, last + 1);
+    if (left != glyphAtlasTextWidth(atlas, drawn, first) || right != glyphAtlasTextWidth(atlas, drawn, last + 1)) {
+        regionInvalidate(id);
+        return;
     }
-    // If no pattern matches, return original
-    return dateStr;
+    const ScreenRect &bounds = regionBounds(id);
+    regionInvalidateRect({(int16_t)(bounds.x + left), bounds.y, (int16_t)(right - left), bounds.h});
 }
 
+// Mark the clock widgets whose text changed; regionFlush() repaints them
 void updateTimeDisplay() {
-    // Adjust X positions for landscape orientation
-    int adjustedTimeXPos = timeXPos;
-    int adjustedDateXPos = dateXPos;
-    
-    // Use position matrix values
-    if (currentRotation == 0 || currentRotation == 2) { // Portrait orientations
-        adjustedTimeXPos = timeXPos + timePos.portrait.xOffset;  // Use portrait offset
-    } else { // Landscape orientations
-        adjustedTimeXPos = timeXPos + timePos.landscape.xOffset;  // Use landscape offset
-        adjustedDateXPos = dateXPos + datePos.landscape.xOffset;
+    if (currentTime.time.length() > 0 && currentTime.time != lastTime) {
+        invalidateChangedGlyphs(WIDGET_TIME, timeGlyphs, lastTime, currentTime.time);
+        lastTime = currentTime.time;
     }
-    
-    // Check if time changed BEFORE we update lastTime
-    bool timeChanged = (currentTime.time.length() > 0 && currentTime.time != lastTime);
-    bool secondsChanged = (currentTime.seconds != lastSeconds);
-    
-    if (currentTime.time.length() > 0) {
-        // Only update time if it changed
-        if (timeChanged) {
-            // Clear only time area, but avoid clearing date area
-            // In landscape, date is at y=70, so clear height must be limited
-            // In portrait, date is at y=60, so we need to be more careful
-            int timeClearHeight = (currentRotation == 1 || currentRotation == 3) ? 35 : 35;
-            // In portrait, limit clear area to avoid overlapping with date at y=60
-            if (currentRotation == 0 || currentRotation == 2) {
-                // Portrait: time is at y=10, date at y=60, so clear only up to y=45 max (leave 15px buffer)
-                timeClearHeight = 35;
-            } else {
-                // Landscape: time is at y=30, date at y=70, so clear only up to y=65 max (leave 5px buffer)
-                timeClearHeight = 35;  // 30 + 35 = 65, which is safe
-            }
-            int timeY = (currentRotation == 0 || currentRotation == 2) ? timePos.portrait.y : timePos.landscape.y;
-            tft.fillRect(adjustedTimeXPos, timeY, 135, timeClearHeight, BACKGROUND);
-            tft.setTextSize(2);
-            tft.setTextColor(TEXT_COLOR, BACKGROUND);
-            tft.drawString(currentTime.time, adjustedTimeXPos, timeY, 4);
-            lastTime = currentTime.time;
-            
-            // Redraw date after time update to ensure it's not partially cleared
-            // This is especially important in landscape mode where time and date are closer
-            if (currentTime.date.length() > 0) {
-                lastDisplayedDate = "";  // Force date redraw
-                // We'll redraw date below, but need to ensure it happens
-            }
-        }
-        
-        // Only update seconds if they changed
-        if (secondsChanged) {
-            int secondsY = (currentRotation == 0 || currentRotation == 2) ? 20 : timePos.landscape.y + 5;  // Adjust for landscape
-            tft.fillRect(adjustedTimeXPos + 135, secondsY, 50, 30, BACKGROUND);  // Clear only seconds area
-            tft.setTextSize(1);
-            tft.setTextColor(TEXT_COLOR, BACKGROUND);
-            tft.drawString(currentTime.seconds, adjustedTimeXPos + 135, secondsY, 4);
-            lastSeconds = currentTime.seconds;
-        }
+    if (currentTime.time.length() > 0 && currentTime.seconds != lastSeconds) {
+        invalidateChangedGlyphs(WIDGET_SECONDS, secondsGlyphs, lastSeconds, currentTime.seconds);
+        lastSeconds = currentTime.seconds;
     }
-    
-    // Only update date if it actually changed (not on every time/seconds update to prevent flickering)
-    // Also track the displayed date string to redraw if needed
-    // IMPORTANT: Always redraw date if lastDisplayedDate is empty (forced redraw after time update)
-    if (currentTime.date.length() > 0) {
-        String displayDate = removeYearFromDate(currentTime.date);
-        bool dateChanged = (currentTime.date != lastDate);
-        bool displayChanged = (displayDate != lastDisplayedDate);
-        bool forceRedraw = (lastDisplayedDate.length() == 0);  // Force redraw if cache was cleared
-        
-        // Update if date changed, display string changed, forced redraw, or initial draw
-        if (dateChanged || displayChanged || forceRedraw || (needRedraw && lastDate.length() == 0)) {
-            tft.setTextSize(1);  // Reduced from 2 to 1 for smaller size
-            tft.setTextColor(TEXT_COLOR, BACKGROUND);
-
-            // Calculate text width and center position
-            // Use more generous width calculation to account for variable character widths in font 2
-            int textWidth = displayDate.length() * 8; // Increased from 6 to 8 for better coverage
-            int centeredDateX = (320 - textWidth) / 2;
-            int dateY = 60;
-
-            // Adjust positioning based on orientation using position matrix
-            int clearWidth = 320;
-            int clearHeight = 25; // default
-            // Compute stock line Y to avoid overlap when clearing date (esp. in landscape)
-            int stockYForRotation = (currentRotation == 0 || currentRotation == 2) ? stockPos.portrait.y : stockPos.landscape.y;
-            if (currentRotation == 0 || currentRotation == 2) { // Portrait orientations
-                centeredDateX = (240 - textWidth) / 2; // Center on 240px width (portrait)
-                dateY = datePos.portrait.y;
-                clearWidth = 240;  // Portrait width - clear full width to prevent partial clearing
-                // Portrait has ample spacing; keep default height
-            } else { // Landscape orientations
-                dateY = datePos.landscape.y;
-                // In landscape, ensure we do not clear into the stock ticker row (typically at y ~90)
-                // But we need enough height to fully clear the date text (at least 20-22px for font 2)
-                // Stock is at y=90, date is at y=70, so we have 20px of space
-                // Use 20px clearHeight to fully cover the date text without overlapping stock
-                clearHeight = 20;  // Fixed height to fully cover date text
-                // Clear full width in landscape too to prevent partial clearing
-            }
-
-            // Clear date area - use full width to ensure nothing else can partially clear it
-            tft.fillRect(0, dateY, clearWidth, clearHeight, BACKGROUND);
-            tft.drawString(displayDate, centeredDateX, dateY, 2);
-            lastDate = currentTime.date;
-            lastDisplayedDate = displayDate;
-        }
+    if (currentTime.date.length() > 0 && currentTime.date != lastDate) {
+        regionInvalidate(WIDGET_DATE);
+        lastDate = currentTime.date;
     }
 }
 
-void updateStockDisplay() {
-    if (spyStock.symbol.length() > 0) {
-        Serial.println("Updating display with stock: " + spyStock.symbol); // Debug statement
+void drawTimeWidget() {
+    TFT_eSprite &out = beginWidget(WIDGET_TIME);
+    if (glyphAtlasCovers(timeGlyphs, currentTime.time)) {
+        glyphAtlasDraw(timeGlyphs, out, currentTime.time, 0, 0, TEXT_COLOR);
+    } else {
+        out.setTextSize(2);
+        out.setTextColor(TEXT_COLOR, BACKGROUND);
+        out.drawString(currentTime.time, 0, 0, 4);
+    }
+    pushWidget();
+}
 
-        // Get stock display position
-        int stockY = (currentRotation == 0 || currentRotation == 2) ? stockPos.portrait.y : stockPos.landscape.y;
-        int stockX = stockPos.portrait.x;  // Same for both modes
-        
-        // Display stock information
-        tft.setTextSize(1);
-
-        // Determine color based on price change (brighter colors for better visibility)
-        uint16_t stockColor = TFT_WHITE;
-        if (spyStock.change > 0) {
-            stockColor = TFT_BRIGHT_GREEN; // Bright green for positive change
-        } else if (spyStock.change < 0) {
-            stockColor = TFT_BRIGHT_RED; // Bright red for negative change
-        }
-
-        // Display stock price and change with better formatting
-        String priceStr = "$" + String(spyStock.price, 2);
-        String changeStr = (spyStock.change >= 0 ? "+" : "") + String(spyStock.change, 2);
-        String percentStr = (spyStock.changePercent >= 0 ? "+" : "") + String(spyStock.changePercent, 2) + "%";
-        String stockInfo = "$SPY: " + priceStr + " (" + changeStr + " / " + percentStr + ")";
-
-        // ALWAYS clear and redraw to prevent disappearing
-        // Calculate clear area to avoid overlapping weather (landscape) or other elements
-        // In landscape: weather icon is at x=265, so clear only up to x=260
-        // In portrait: full width is fine
-        int clearWidth = (currentRotation == 0 || currentRotation == 2) ? 240 : 255;  // Leave room for weather icon
-        // Font 2 needs full character height including ascenders/descenders
-        // Clear starting 2px above draw position to capture ascenders, and 22px tall total
-        // In landscape, ensure we don't clear the date area (date is at y=70, stock at y=90)
-        // Date clearHeight is 20px (y=70 to y=90), so stock should start clearing from y=90
-        int clearY = stockY;
-        int clearHeight = 22;
-        if (currentRotation == 1 || currentRotation == 3) { // Landscape
-            // Don't clear above stock position in landscape to avoid clearing date
-            clearY = stockY;  // Start at stockY, not stockY - 2
-            clearHeight = 22;  // Keep same height
-        } else {
-            // Portrait: can clear 2px above as before
-            clearY = stockY - 2;
-        }
-        tft.fillRect(stockX, clearY, clearWidth, clearHeight, BACKGROUND);  // Clear stock area
-        
-        // Render with background to avoid partial erasure artifacts when other areas refresh
-        tft.setTextColor(stockColor, BACKGROUND);
-        tft.drawString(stockInfo, stockX, stockY, 2);  // Draw at exact Y position
-        lastStockDisplay = stockInfo;
+void drawSecondsWidget() {
+    TFT_eSprite &out = beginWidget(WIDGET_SECONDS);
+    if (glyphAtlasCovers(secondsGlyphs, currentTime.seconds)) {
+        glyphAtlasDraw(secondsGlyphs, out, currentTime.seconds, 0, 0, TEXT_COLOR);
     } else {
-        Serial.println("No stock data to display."); // Debug statement
+        out.setTextSize(1);
+        out.setTextColor(TEXT_COLOR, BACKGROUND);
+        out.drawString(currentTime.seconds, 0, 0, 4);
     }
+    pushWidget();
 }
 
-void updateWeatherDisplay() {
-    if (currentWeather.conditions.length() > 0) {
-        Serial.println("Updating display with weather: " + currentWeather.conditions); // Debug statement
+void drawDateWidget() {
+    TFT_eSprite &out = beginWidget(WIDGET_DATE);
+    String displayDate = currentTime.date;  // Already formatted without the year
+    // Centre in the full-width row
+    int textWidth = fontTextWidth(displayDate, 2);
+    out.setTextSize(1);  // Reduced from 2 to 1 for smaller size
+    out.setTextColor(TEXT_COLOR, BACKGROUND);
+    out.drawString(displayDate, (widgetRect.w - textWidth) / 2, 0, 2);
+    pushWidget();
+}
 
-        // Clear only the weather area using position matrix
-        int clearWidth = 320;
-        int clearHeight = 20;  // Precise height for text
-        int weatherY;
-        int weatherX = weatherXPos;
-        
-        if (currentRotation == 0 || currentRotation == 2) { // Portrait
-            weatherY = weatherTextPos.portrait.y;
-            clearHeight = 65;  // 3 lines in portrait (20px per line + spacing)
-            clearWidth = 185;  // Leave room for weather icon at x=190
-        } else { // Landscape
-            weatherY = weatherTextPos.landscape.y;
-            clearWidth = 260;  // Clear left side only, leave room for icon at x=265
-        }
-        tft.fillRect(weatherX, weatherY, clearWidth, clearHeight, BACKGROUND);
-
-        // Display weather information
-        tft.setTextSize(1);
-
-        // Determine color based on temperature
-        uint16_t tempColor = TFT_WHITE;
-        if (currentWeather.temperature <= 32) {
-            tempColor = TFT_BLUE; // Cold
-        } else if (currentWeather.temperature <= 60) {
-            tempColor = TFT_WHITE; // Mild
-        } else if (currentWeather.temperature <= 85) {
-            tempColor = TFT_ORANGE; // Warm
-        } else {
-            tempColor = TFT_RED; // Hot
-        }
+// One line of status text in a widget. The widget's draw function and
+// markTextChanges() both build their lines with statusLines(), so what is
+// diffed is exactly what is drawn.
+const int MAX_STATUS_LINES = 3;
+struct StatusLine {
+    String text;
+    uint16_t color;
+    int16_t x, y;    // Offset from the widget's top left
+    uint8_t font;
+    IconId icon;     // Status glyph before the text in the line's colour, or ICON_NONE
+};
 
-        tft.setTextColor(tempColor);
+// Status glyphs sit on a font 2 line, with a gap before the text
+const int STATUS_ICON_TOP = 2;
+const int STATUS_ICON_ADVANCE = ICON_STATUS_SIZE + 4;
 
-        // Display weather info
-        int tempC = (currentWeather.temperature - 32) * 5 / 9;
-        int feelsC = (currentWeather.feels_like - 32) * 5 / 9;
+// Status glyph on the panel for a line
+struct LineIcon {
+    IconId icon;
+    uint16_t color;
+    ScreenRect cell;   // Panel rectangle; empty without a glyph
+};
 
-        int weatherTextX = weatherXPos;  // Same for both modes
-        if (currentRotation == 1 || currentRotation == 3) { // Landscape orientations
-            // Single line: Temp & Feels like with Celsius
-            String weatherInfo = String(currentWeather.temperature) + "°F/" + String(tempC) + "°C Feels: " + String(currentWeather.feels_like) + "°F/" + String(feelsC) + "°C H: " + String(currentWeather.humidity) + "%";
-            tft.drawString(weatherInfo, weatherTextX, weatherY, 2);
-        } else { // Portrait
-            // Multiple lines for portrait (more readable)
-            String tempInfo = "Temp: " + String(currentWeather.temperature) + "°F/" + String(tempC) + "°C";
-            String feelsInfo = "Feels: " + String(currentWeather.feels_like) + "°F/" + String(feelsC) + "°C";
-            String humidityInfo = "Humidity: " + String(currentWeather.humidity) + "%";
-            tft.drawString(tempInfo, weatherTextX, weatherY, 2);
-            tft.drawString(feelsInfo, weatherTextX, weatherY + weatherTextPos.portrait.lineSpacing, 2);
-            tft.drawString(humidityInfo, weatherTextX, weatherY + weatherTextPos.portrait.lineSpacing * 2, 2);
-        }
+// What is on the panel for each line, for glyph-level diffs
+TextRun textRuns[WIDGET_COUNT][MAX_STATUS_LINES];
+LineIcon lineIcons[WIDGET_COUNT][MAX_STATUS_LINES];
+
+// Offset of the line's text from the widget's top left
+int16_t statusTextX(const StatusLine &line) {
+    return line.icon != ICON_NONE ? line.x + STATUS_ICON_ADVANCE : line.x;
+}
+
+int stockLines(StatusLine *lines) {
+    if (spyStock.symbol.length() == 0) {
+        return 0;
+    }
+    // Determine color based on price change (brighter colors for better visibility)
+    uint16_t stockColor = TFT_WHITE;
+    if (spyStock.change > 0) {
+        stockColor = TFT_BRIGHT_GREEN; // Bright green for positive change
+    } else if (spyStock.change < 0) {
+        stockColor = TFT_BRIGHT_RED; // Bright red for negative change
+    }
+
+    // Display stock price and change with better formatting
+    String priceStr = "$" + String(spyStock.price, 2);
+    String changeStr = (spyStock.change >= 0 ? "+" : "") + String(spyStock.change, 2);
+    String percentStr = (spyStock.changePercent >= 0 ? "+" : "") + String(spyStock.changePercent, 2) + "%";
+    String stockInfo = "$SPY: " + priceStr + " (" + changeStr + " / " + percentStr + ")";
+
+    lines[0] = {stockInfo, stockColor, 0, screenLayout().stockTextY, 2, ICON_NONE};
+    return 1;
+}
+
+int weatherLines(StatusLine *lines) {
+    if (currentWeather.conditions.length() == 0) {
+        return 0;
+    }
+    // Determine color based on temperature
+    uint16_t tempColor = TFT_WHITE;
+    if (currentWeather.temperature <= 32) {
+        tempColor = TFT_BLUE; // Cold
+    } else if (currentWeather.temperature <= 60) {
+        tempColor = TFT_WHITE; // Mild
+    } else if (currentWeather.temperature <= 85) {
+        tempColor = TFT_ORANGE; // Warm
+    } else {
+        tempColor = TFT_RED; // Hot
+    }
+
+    // Display weather info
+    int tempC = (currentWeather.temperature - 32) * 5 / 9;
+    int feelsC = (currentWeather.feels_like - 32) * 5 / 9;
 
-        // Draw static weather icon
-        drawWeatherIconStatic();
+    if (screenLayout().landscape) {
+        // Single line: Temp & Feels like with Celsius
+        String weatherInfo = String(currentWeather.temperature) + "°F/" + String(tempC) + "°C Feels: " + String(currentWeather.feels_like) + "°F/" + String(feelsC) + "°C H: " + String(currentWeather.humidity) + "%";
+        lines[0] = {weatherInfo, tempColor, 0, 0, 2, ICON_NONE};
+        return 1;
+    }
+    // Multiple lines for portrait (more readable)
+    int16_t spacing = screenLayout().lineSpacing;
+    lines[0] = {"Temp: " + String(currentWeather.temperature) + "°F/" + String(tempC) + "°C", tempColor, 0, 0, 2, ICON_NONE};
+    lines[1] = {"Feels: " + String(currentWeather.feels_like) + "°F/" + String(feelsC) + "°C", tempColor, 0, spacing, 2, ICON_NONE};
+    lines[2] = {"Humidity: " + String(currentWeather.humidity) + "%", tempColor, 0, (int16_t)(spacing * 2), 2, ICON_NONE};
+    return 3;
+}
+
+// Draw a widget made only of status lines
+void drawStatusLines(TFT_eSprite &out, const StatusLine *lines, int count) {
+    out.setTextSize(1);
+    for (int i = 0; i < count; i++) {
+        iconDraw(out, lines[i].icon, lines[i].x, lines[i].y + STATUS_ICON_TOP, lines[i].color, BACKGROUND);
+        out.setTextColor(lines[i].color, BACKGROUND);
+        out.drawString(lines[i].text, statusTextX(lines[i]), lines[i].y, lines[i].font);
+    }
+}
+
+void drawStockWidget() {
+    TFT_eSprite &out = beginWidget(WIDGET_STOCK);
+    StatusLine lines[MAX_STATUS_LINES];
+    int count = stockLines(lines);
+    if (count > 0) {
+        Serial.println("Updating display with stock: " + spyStock.symbol); // Debug statement
+        drawStatusLines(out, lines, count);
+    } else {
+        Serial.println("No stock data to display."); // Debug statement
+    }
+    pushWidget();
+}
+
+void drawWeatherTextWidget() {
+    TFT_eSprite &out = beginWidget(WIDGET_WEATHER_TEXT);
+    StatusLine lines[MAX_STATUS_LINES];
+    int count = weatherLines(lines);
+    if (count > 0) {
+        Serial.println("Updating display with weather: " + currentWeather.conditions); // Debug statement
+        drawStatusLines(out, lines, count);
     } else {
         Serial.println("No weather data to display."); // Debug statement
     }
+    pushWidget();
 }
 
 // Function to draw forecast view (today and tomorrow) when refresh button is held
@@ -779,8 +789,8 @@ void drawForecastView() {
     tft.setTextColor(TFT_CYAN);
     tft.setTextSize(1);
 
-    int screenWidth = (currentRotation == 1 || currentRotation == 3) ? 320 : 240;
-    int screenHeight = (currentRotation == 1 || currentRotation == 3) ? 240 : 320;
+    int screenWidth = screenLayout().width;
+    int screenHeight = screenLayout().height;
 
     // Draw title centered
     tft.drawString("Weather Forecast", screenWidth / 2 - 70, 10, 2);
@@ -809,7 +819,7 @@ void drawForecastView() {
     tft.drawString(weatherForecast.today.conditions, 10, todayY + 50, 2);
 
     // Draw today's weather icon
-    drawWeatherIcon(weatherForecast.today.icon, screenWidth - 60, todayY + 10);
+    iconDraw(tft, weatherForecast.today.icon, screenWidth - 60, todayY + 10, TEXT_COLOR, BACKGROUND);
 
     // Tomorrow section
     int tomorrowY = todayY + 90;
@@ -829,9 +839,7 @@ void drawForecastView() {
         tft.drawString(weatherForecast.tomorrow.conditions, 10, tomorrowY + 50, 2);
 
         // Draw tomorrow's weather icon
-        if (weatherForecast.tomorrow.icon.length() > 0) {
-            drawWeatherIcon(weatherForecast.tomorrow.icon, screenWidth - 60, tomorrowY + 10);
-        }
+        iconDraw(tft, weatherForecast.tomorrow.icon, screenWidth - 60, tomorrowY + 10, TEXT_COLOR, BACKGROUND);
     } else {
         // Forecast not available
         tft.setTextColor(TFT_GREY);
@@ -843,289 +851,198 @@ void drawForecastView() {
     tft.drawString("Release button to return", 10, screenHeight - 25, 1);
 }
 
-// Function to redraw main screen after returning from forecast view
+// Give every widget its box from the current rotation's layout table; where
+// boxes would overlap the build fails (see LAYOUT)
+void layoutWidgets() {
+    static void (*const drawFunctions[WIDGET_COUNT])() = {
+        drawDateWidget, drawTimeWidget, drawSecondsWidget, drawStockWidget, drawWeatherTextWidget,
+        drawCoffeeWidget, drawTrailWidget, drawWeatherIconWidget, drawPrinterWidget, drawStaleMarker,
+    };
+    const ScreenLayout &layout = screenLayout();
+    for (int id = 0; id < WIDGET_COUNT; id++) {
+        regionSetWidget(id, layout.widgets[id], drawFunctions[id]);
+    }
+}
+
+// Repaint the widgets marked dirty since the last flush. Nothing is painted over
+// the forecast view; redrawMainScreen() repaints everything when it closes.
+void flushScreen() {
+    if (!isShowingForecast && regionPending()) {
+        beginDisplayBatch();
+        regionFlush();
+        endDisplayBatch();
+    }
+}
+
+// Clear the screen and repaint every widget, e.g. after the forecast view, a
+// rotation or a layout change
 void redrawMainScreen() {
+    unsigned long start = micros();
+    layoutWidgets();
     tft.fillScreen(BACKGROUND);
-    needRedraw = true;
-
-    // Clear cached display values to force full redraw
-    lastTime = "";
-    lastSeconds = "";
-    lastDate = "";
-    lastDisplayedDate = "";
-    lastStockDisplay = "";
-    lastCoffeeStatus = "";
-
-    // Force redraw of all elements (countdown is hidden/unused)
-    updateTimeDisplay();
-    updateWeatherDisplay();
-    updateStockDisplay();
-    updateCoffeeMachineDisplay();
-    updateTrailDisplay();
-    updatePrinterDisplay();
-    drawWeatherIconStatic();
-}
-
-void updateCoffeeMachineDisplay() {
+    // Bring the text runs up to date with the new layout; everything is repainted anyway
+    markTextChanges(WIDGET_STOCK);
+    markTextChanges(WIDGET_WEATHER_TEXT);
+    markTextChanges(WIDGET_COFFEE);
+    markTextChanges(WIDGET_TRAILS);
+    regionInvalidateAll();
+    flushScreen();
+    lastFullRedrawUs = micros() - start;
+}
+
+uint16_t coffeeStatusColor() {
     // Determine color based on coffee machine status (brighter colors for better visibility)
-    uint16_t statusColor = TFT_WHITE;
     if (coffeeMachine.esp32Status == "offline") {
-        statusColor = TFT_BRIGHT_YELLOW; // Bright yellow when ESP32 is offline
+        return TFT_BRIGHT_YELLOW; // Bright yellow when ESP32 is offline
     } else if (coffeeMachine.status == "On") {
-        statusColor = TFT_BRIGHT_GREEN; // Bright green when coffee machine is on
+        return TFT_BRIGHT_GREEN; // Bright green when coffee machine is on
     } else if (coffeeMachine.status == "Off") {
-        statusColor = TFT_BRIGHT_RED; // Bright red when coffee machine is off
+        return TFT_BRIGHT_RED; // Bright red when coffee machine is off
     }
+    return TFT_WHITE;
+}
 
-    // Check if status or scheduled time changed to avoid unnecessary redraws
-    String currentStatusKey = coffeeMachine.status + "|" + coffeeMachine.scheduledTime + "|" + coffeeMachine.esp32Status;
-    bool statusChanged = (currentStatusKey != lastCoffeeStatus);
-
-    if (currentRotation == 1 || currentRotation == 3) {
-        // Landscape orientation: use icon at top right next to time
-        int iconX = coffeePos.landscape.x;
-        int iconY = coffeePos.landscape.y;
-        
-        // Always draw the coffee icon (it clears its own 40x40 area)
-        // The icon needs to be visible, so we always draw it
-        drawCoffeeIcon(statusColor, iconX, iconY);
-        
-        // Draw scheduled time if available, or use cached value to prevent disappearing
-        int timeTextX = iconX;
-        int timeTextY = iconY + 42;  // Below 40px icon + 2px spacing
+int coffeeLines(StatusLine *lines) {
+    uint16_t statusColor = coffeeStatusColor();
+    const ScreenLayout &layout = screenLayout();
+    if (layout.landscape) {
+        // Landscape: the scheduled time under the icon, or the last one shown while the server has none
         String timeToDisplay = coffeeMachine.scheduledTime.length() > 0 ? coffeeMachine.scheduledTime : lastCoffeeDisplayTime;
-        
-        // Only clear and redraw time if it changed, status changed, or if we need initial display
-        bool timeNeedsUpdate = statusChanged || 
-                              (timeToDisplay.length() > 0 && timeToDisplay != lastCoffeeDisplayTime) ||
-                              (lastCoffeeDisplayTime.length() == 0 && timeToDisplay.length() > 0);
-        
-        if (timeNeedsUpdate) {
-            // Clear starting 1px above draw position to capture ascenders, and 18px tall total
-            // Make sure we clear a wider area to prevent other functions from clearing it
-            tft.fillRect(timeTextX - 2, timeTextY - 1, 44, 20, BACKGROUND);  // Clear time text area with extra padding
-            
-            if (timeToDisplay.length() > 0) {
-                tft.setTextSize(1);
-                tft.setTextColor(statusColor, BACKGROUND);
-                tft.drawString(timeToDisplay, timeTextX, timeTextY, 1);  // Font 1 (small)
-                lastCoffeeDisplayTime = timeToDisplay;  // Cache the displayed time
-            } else if (lastCoffeeDisplayTime.length() > 0) {
-                // Redraw cached time if scheduledTime is empty
-                tft.setTextSize(1);
-                tft.setTextColor(statusColor, BACKGROUND);
-                tft.drawString(lastCoffeeDisplayTime, timeTextX, timeTextY, 1);
-            }
-        }
-    } else {
-        // Portrait orientation (0 or 2): use text display using position matrix
-        int coffeeY = coffeePos.portrait.y;
-        tft.fillRect(0, coffeeY, 320, 20, BACKGROUND);
-
-        // Display coffee machine status with icon indicator
-        tft.setTextSize(1); // Match the weather text size
-        tft.setTextColor(statusColor);
-        String icon = coffeeMachine.status == "On" ? "●" : "○";
-        String statusInfo = "Coffee: " + icon + " " + coffeeMachine.status;
-        if (coffeeMachine.status == "On" && coffeeMachine.scheduledTime.length() > 0) {
-            statusInfo += " @ " + coffeeMachine.scheduledTime; // Append scheduled time if on
-        }
-        if (coffeeMachine.esp32Status == "offline") {
-            statusInfo += " [OFFLINE]";
+        if (timeToDisplay.length() == 0) {
+            return 0;
         }
-
-        tft.drawString(statusInfo, coffeePos.portrait.x, coffeeY, 2); // Position below weather
+        lastCoffeeDisplayTime = timeToDisplay;
+        lines[0] = {timeToDisplay, statusColor, layout.coffeeTextX, layout.coffeeTextY, 1, ICON_NONE};  // Font 1 (small), below the 40px icon
+        return 1;
     }
-    
-    // Update last status key to track changes
-    lastCoffeeStatus = currentStatusKey;
+    // Portrait: status text after a full or empty dot
+    IconId icon = coffeeMachine.status == "On" ? ICON_STATUS_FULL : ICON_STATUS_EMPTY;
+    String statusInfo = "Coffee: " + coffeeMachine.status;
+    if (coffeeMachine.status == "On" && coffeeMachine.scheduledTime.length() > 0) {
+        statusInfo += " @ " + coffeeMachine.scheduledTime; // Append scheduled time if on
+    }
+    if (coffeeMachine.esp32Status == "offline") {
+        statusInfo += " [OFFLINE]";
+    }
+    lines[0] = {statusInfo, statusColor, layout.coffeeTextX, layout.coffeeTextY, 2, icon};
+    return 1;
 }
 
-// Helper function to get trail status icon
-String getTrailStatusIcon(String status) {
-    if (status == "open") return "●";
-    else if (status == "closed") return "●";
-    else if (status == "wet" || status == "caution") return "◐";
-    else if (status == "freeze") return "○";
-    return "?";
+void drawCoffeeWidget() {
+    TFT_eSprite &out = beginWidget(WIDGET_COFFEE);
+    if (screenLayout().landscape) {
+        // Landscape orientation: icon at top right next to time, scheduled time below it.
+        // Both are one widget, with 2px of padding left of the icon.
+        drawCoffeeIcon(out, coffeeStatusColor(), 2, 0);
+    }
+    StatusLine lines[MAX_STATUS_LINES];
+    drawStatusLines(out, lines, coffeeLines(lines));
+    pushWidget();
 }
 
-void updateTrailDisplay() {
-    // Use position matrix for trail Y positions
-    int mombaY, johnBryanY, caesarCreekY, clearY;
-    int clearHeight = 50;
-    
-    if (currentRotation == 1 || currentRotation == 3) { // Landscape orientations
-        mombaY = trailPos.landscape.mombaY;
-        johnBryanY = trailPos.landscape.johnBryanY;
-        caesarCreekY = trailPos.landscape.caesarCreekY;
-        clearY = mombaY;
-    } else { // Portrait orientations
-        mombaY = trailPos.portrait.mombaY;
-        johnBryanY = trailPos.portrait.johnBryanY;
-        caesarCreekY = trailPos.portrait.caesarCreekY;
-        clearY = mombaY;
-    }
-    
-    // Clear the full trail status area (adjusted for rotation)
-    // Use full screen width to ensure all text is cleared, including long status strings
-    int clearWidth = (currentRotation == 0 || currentRotation == 2) ? 240 : 320;  // Full width
-    tft.fillRect(0, clearY, clearWidth, clearHeight, BACKGROUND);
+// Helper function to get trail status icon; the colour tells open from closed
+IconId getTrailStatusIcon(const String &status) {
+    if (status == "open" || status == "closed") return ICON_STATUS_FULL;
+    else if (status == "wet" || status == "caution") return ICON_STATUS_HALF;
+    return ICON_STATUS_EMPTY;  // Freeze, or unknown (in white)
+}
 
-    // Display trail statuses with icons
-    tft.setTextSize(1);
+int trailLines(StatusLine *lines) {
+    const ScreenLayout &layout = screenLayout();
+    int16_t y = layout.trailTextY;
+    int16_t x = 0;
+
+    lines[0] = {"Momba " + mombaTrail.lastUpdate, getTrailStatusColor(mombaTrail.status), x, y, 2,
+                getTrailStatusIcon(mombaTrail.status)};
+    lines[1] = {"JBryan " + johnBryanTrail.lastUpdate, getTrailStatusColor(johnBryanTrail.status), x,
+                (int16_t)(y + layout.lineSpacing), 2, getTrailStatusIcon(johnBryanTrail.status)};
+    lines[2] = {"C.Creek " + caesarCreekTrail.lastUpdate, getTrailStatusColor(caesarCreekTrail.status), x,
+                (int16_t)(y + 2 * layout.lineSpacing), 2, getTrailStatusIcon(caesarCreekTrail.status)};
+    return 3;
+}
 
-    // Momba Trail - use position matrix X position
-    // Clear individual line area before drawing to prevent text remnants
-    tft.fillRect(0, mombaY - 2, clearWidth, 22, BACKGROUND);  // Clear individual line with padding
-    uint16_t mombaColor = getTrailStatusColor(mombaTrail.status);
-    tft.setTextColor(mombaColor, BACKGROUND);  // Use background color to prevent artifacts
-    String mombaIcon = getTrailStatusIcon(mombaTrail.status);
-    tft.drawString(mombaIcon + " Momba " + mombaTrail.lastUpdate, trailStatusXPos, mombaY, 2);
-
-    // John Bryan Trail
-    // Clear individual line area before drawing
-    tft.fillRect(0, johnBryanY - 2, clearWidth, 22, BACKGROUND);  // Clear individual line with padding
-    uint16_t johnBryanColor = getTrailStatusColor(johnBryanTrail.status);
-    tft.setTextColor(johnBryanColor, BACKGROUND);  // Use background color to prevent artifacts
-    String jbIcon = getTrailStatusIcon(johnBryanTrail.status);
-    tft.drawString(jbIcon + " JBryan " + johnBryanTrail.lastUpdate, trailStatusXPos, johnBryanY, 2);
-
-    // Caesar Creek Trail
-    // Clear individual line area before drawing to prevent text remnants
-    tft.fillRect(0, caesarCreekY - 2, clearWidth, 22, BACKGROUND);  // Clear individual line with padding
-    uint16_t caesarCreekColor = getTrailStatusColor(caesarCreekTrail.status);
-    tft.setTextColor(caesarCreekColor, BACKGROUND);  // Use background color to prevent artifacts
-    String ccIcon = getTrailStatusIcon(caesarCreekTrail.status);
-    tft.drawString(ccIcon + " C.Creek " + caesarCreekTrail.lastUpdate, trailStatusXPos, caesarCreekY, 2);
-}
-
-// Helper function to check if a year is a leap year
-bool isLeapYear(int year) {
-    return ((year % 4 == 0 && year % 100 != 0) || (year % 400 == 0));
-}
-
-// Helper function to get days in a year
-int getDaysInYear(int year) {
-    return isLeapYear(year) ? 366 : 365;
-}
-
-// Helper function to calculate day of year from month and day
-int getDayOfYear(int month, int day, int year) {
-    int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-    int dayOfYear = day;
-    
-    for (int i = 0; i < month - 1; i++) {
-        dayOfYear += daysInMonth[i];
-    }
-    
-    // Add leap day if it's a leap year and we're past February
-    if (month > 2 && isLeapYear(year)) {
-        dayOfYear += 1;
-    }
-    
-    return dayOfYear;
+void drawTrailWidget() {
+    // One widget for all three lines (see layoutWidgets())
+    TFT_eSprite &out = beginWidget(WIDGET_TRAILS);
+    StatusLine lines[MAX_STATUS_LINES];
+    drawStatusLines(out, lines, trailLines(lines));
+    pushWidget();
 }
 
-// Function to calculate days until December 11th
-int calculateDaysUntil1211() {
-    // Get current epoch time
-    timeClient.update();
-    unsigned long currentEpoch = timeClient.getEpochTime();
-    
-    // Calculate current date from epoch time
-    // Epoch: January 1, 1970 00:00:00 UTC
-    unsigned long secondsPerDay = 86400;
-    unsigned long daysSinceEpoch = currentEpoch / secondsPerDay;
-    
-    // Approximate current year (starting from 1970)
-    // Account for leap years: approximately 365.25 days per year
-    int approximateYear = 1970 + (daysSinceEpoch / 365);
-    
-    // Refine year calculation by checking actual days
-    int currentYear = approximateYear;
-    unsigned long daysToCurrentYear = 0;
-    for (int year = 1970; year < currentYear; year++) {
-        daysToCurrentYear += getDaysInYear(year);
-    }
-    
-    // Adjust if we overshot
-    while (daysToCurrentYear > daysSinceEpoch && currentYear > 1970) {
-        currentYear--;
-        daysToCurrentYear -= getDaysInYear(currentYear);
-    }
-    
-    // Calculate remaining days in current year
-    unsigned long daysIntoYear = daysSinceEpoch - daysToCurrentYear;
-    
-    // Find current month and day
-    int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-    if (isLeapYear(currentYear)) {
-        daysInMonth[1] = 29;  // February has 29 days in leap year
-    }
-    
-    int currentMonth = 1;
-    int currentDay = 1;
-    unsigned long remainingDays = daysIntoYear;
-    
-    for (int i = 0; i < 12; i++) {
-        if (remainingDays >= daysInMonth[i]) {
-            remainingDays -= daysInMonth[i];
-            currentMonth++;
+// Mark only the glyph cells of a text widget that differ from what is on the
+// panel. Lines that went away are diffed against empty text, which clears them.
+void markTextChanges(ScreenWidget id) {
+    StatusLine lines[MAX_STATUS_LINES];
+    int count = 0;
+    switch (id) {
+        case WIDGET_STOCK: count = stockLines(lines); break;
+        case WIDGET_WEATHER_TEXT: count = weatherLines(lines); break;
+        case WIDGET_COFFEE: count = coffeeLines(lines); break;
+        case WIDGET_TRAILS: count = trailLines(lines); break;
+        default: regionInvalidate(id); return;
+    }
+    const ScreenRect &bounds = regionBounds(id);
+    TextRun *runs = textRuns[id];
+    // The landscape coffee icon takes the status colour too, so a new colour repaints it all
+    if (id == WIDGET_COFFEE && screenLayout().landscape && runs[0].color != coffeeStatusColor()) {
+        regionInvalidate(id);
+    }
+    for (int i = 0; i < MAX_STATUS_LINES; i++) {
+        ScreenRect changed;
+        LineIcon icon = {ICON_NONE, 0, {0, 0, 0, 0}};
+        if (i < count) {
+            changed = textRunUpdate(runs[i], lines[i].text, lines[i].color, bounds.x + statusTextX(lines[i]),
+                                    bounds.y + lines[i].y, lines[i].font);
+            if (lines[i].icon != ICON_NONE) {
+                icon = {lines[i].icon, lines[i].color, {(int16_t)(bounds.x + lines[i].x),
+                        (int16_t)(bounds.y + lines[i].y + STATUS_ICON_TOP), ICON_STATUS_SIZE, ICON_STATUS_SIZE}};
+            }
         } else {
-            currentDay = remainingDays + 1;
-            break;
+            changed = textRunUpdate(runs[i], "", runs[i].color, runs[i].x, runs[i].y, runs[i].font);
+        }
+        regionInvalidateRect(regionIntersection(changed, bounds));
+
+        // A glyph that changed is repainted where it was and where it goes
+        LineIcon &shown = lineIcons[id][i];
+        if (icon.icon != shown.icon || icon.color != shown.color || icon.cell.x != shown.cell.x || icon.cell.y != shown.cell.y) {
+            regionInvalidateRect(regionIntersection(shown.cell, bounds));
+            regionInvalidateRect(regionIntersection(icon.cell, bounds));
+            shown = icon;
         }
     }
+}
+
+// Function to calculate days until December 11th (local date)
+int calculateDaysUntil1211() {
+    CivilTime now = civilTimeFromUtc(time(NULL));
     
-    // Calculate target date (December 11 of current year, or next year if already past)
-    int targetYear = currentYear;
-    int targetMonth = 12;
-    int targetDay = 11;
-    
-    // If December 11 has already passed this year, target next year
-    if (currentMonth > 12 || (currentMonth == 12 && currentDay > 11)) {
-        targetYear = currentYear + 1;
-    }
-    
-    // Calculate day of year for both dates
-    int currentDayOfYear = getDayOfYear(currentMonth, currentDay, currentYear);
-    int targetDayOfYear = getDayOfYear(targetMonth, targetDay, targetYear);
-    
-    // Calculate days difference
-    int daysDiff;
-    if (targetYear == currentYear) {
-        // Same year: simple difference
-        daysDiff = targetDayOfYear - currentDayOfYear;
-    } else {
-        // Different year: days remaining this year + days in target year
-        int daysInCurrentYear = getDaysInYear(currentYear);
-        daysDiff = (daysInCurrentYear - currentDayOfYear) + targetDayOfYear;
+    // December 11 of the current year, or next year if already past
+    int targetYear = now.year;
+    if (now.month == 12 && now.day > 11) {
+        targetYear = now.year + 1;
     }
-    
-    return daysDiff;
+    return civilDayNumber(targetYear, 12, 11) - civilDayNumber(now.year, now.month, now.day);
 }
 
 // Function to update countdown timer display
 void updateCountdownDisplay() {
+    if (!screenLayout().countdownShown) {
+        return;  // Row would draw over a widget in this rotation
+    }
     int daysRemaining = calculateDaysUntil1211();
     
     // Only update if days changed or if forced redraw
     if (daysRemaining != lastCountdownDays || needRedraw) {
         // Get screen dimensions and countdown position
-        int screenWidth = (currentRotation == 0 || currentRotation == 2) ? 240 : 320;
-        int screenHeight = (currentRotation == 0 || currentRotation == 2) ? 320 : 240;
-        int countdownY = (currentRotation == 0 || currentRotation == 2) ? countdownPos.portrait.y : countdownPos.landscape.y;
+        int screenWidth = screenLayout().width;
+        int screenHeight = screenLayout().height;
+        int countdownY = screenLayout().countdownY;
         
         // Format countdown text
         String countdownText = String(daysRemaining) + " days";
         
-        // Use large text size (size 2 for font 4 = big text)
-        tft.setTextSize(2);
-        
-        // Calculate text width (approximate: font 4 size 2 is about 14-16 pixels per character for large numbers)
-        // Be generous to account for variable character widths
-        int textWidth = countdownText.length() * 16;
+        // Large text: font 4 at size 2
+        int textWidth = fontTextWidth(countdownText, 4) * 2;
         
         // Position at right bottom (right-aligned), moved 15 pixels to the left
         int countdownX = screenWidth - textWidth - 5 - 65;  // 5px margin from right edge + 15px left offset
@@ -1140,224 +1057,231 @@ void updateCountdownDisplay() {
         if (clearX + clearWidth > screenWidth) clearWidth = screenWidth - clearX;
         if (countdownY + clearHeight > screenHeight) clearHeight = screenHeight - countdownY;
         
-        // Clear the area
-        tft.fillRect(clearX, countdownY, clearWidth, clearHeight, BACKGROUND);
-        
         // Draw countdown text in big text
-        tft.setTextColor(TEXT_COLOR, BACKGROUND);
-        tft.drawString(countdownText, countdownX, countdownY, 4);  // Font 4 for big text
+        TFT_eSprite &out = beginWidget(clearX, countdownY, clearWidth, clearHeight);
+        out.setTextSize(2);
+        out.setTextColor(TEXT_COLOR, BACKGROUND);
+        out.drawString(countdownText, countdownX - clearX, 0, 4);  // Font 4 for big text
+        pushWidget();
         
         lastCountdownDays = daysRemaining;
     }
 }
 
 
-bool fetchTrailStatus(TrailInfo &trail, const String &trailId) {
-    HTTPClient http;
+// Copy trail fields from a parsed /api/trail/trails/<id> object
+void parseTrailJson(JsonVariantConst json, TrailInfo &trail) {
+    trail.status = json["status"].as<String>();
+    String fullDate = json["last_update"].as<String>();
+    trail.lastUpdate = fullDate.substring(0, 10); // Extract only the date part
+}
+
+// Select the fields parseTrailJson reads
+void addTrailFilter(JsonObject filter) {
+    filter["status"] = true;
+    filter["last_update"] = true;
+}
+
+FetchStatus fetchTrailStatus(TrailInfo &trail, const String &trailId) {
     // Use cached endpoint (GET) - server refreshes data every 30 minutes
-    String url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/trail/trails/" + trailId;
-    
-    http.begin(url);
-    int httpCode = http.GET();
+    PooledConnection *conn = httpPoolAcquire(serverHost, serverPort, "/api/trail/trails/" + trailId);
+    if (conn == NULL) {
+        return FETCH_FAILED;
+    }
+    int httpCode = httpPoolSend(conn, "GET");
     
     if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        
-        // Parse JSON response
-        StaticJsonDocument<400> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+        // Parse straight from the socket, keeping only the fields we display
+        static StaticJsonDocument<64> filter;
+        if (filter.isNull()) {
+            addTrailFilter(filter.to<JsonObject>());
+        }
+        StaticJsonDocument<256> doc;
+        DeserializationError error = httpParseJsonBody(conn->http, doc, filter);
         
         if (!error) {
-            trail.status = doc["status"].as<String>();
-            String fullDate = doc["last_update"].as<String>();
-            trail.lastUpdate = fullDate.substring(0, 10); // Extract only the date part
+            parseTrailJson(doc, trail);
             Serial.println("Extracted trail status: " + trail.status + ", Date: " + trail.lastUpdate); // Debug statement
-            http.end();
-            return true;
+            httpPoolCacheValidators(conn);
+            httpPoolRelease(conn);
+            return FETCH_UPDATED;
         } else {
             Serial.println("Failed to parse trail JSON: " + String(error.c_str())); // Debug statement
         }
+    } else if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        // Unchanged since the last successful fetch; 304 has no body
+        httpPoolRelease(conn);
+        return FETCH_NOT_MODIFIED;
     } else {
         Serial.println("HTTP request for trail status failed with code: " + String(httpCode)); // Debug statement
     }
-    http.end();
-    return false;
+    httpPoolRelease(conn);
+    return FETCH_FAILED;
 }
 
 // Function to force server-side refresh of all trails (POST request)
 // Call this when user presses refresh button for fresh data from sources
 bool refreshAllTrails() {
-    HTTPClient http;
-    String url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/trail/refresh";
-
     Serial.println("Forcing server-side trail refresh (POST)...");
-    http.begin(url);
-    http.setTimeout(30000);  // 30 second timeout - refresh can take time
-    int httpCode = http.POST("");  // Empty POST body
+    // 30 second timeout - refresh can take time
+    PooledConnection *conn = httpPoolAcquire(serverHost, serverPort, "/api/trail/refresh", 30000);
+    if (conn == NULL) {
+        return false;
+    }
+    int httpCode = httpPoolSend(conn, "POST");  // Empty POST body
 
     if (httpCode == HTTP_CODE_OK) {
         Serial.println("Server trail refresh completed successfully");
-        http.end();
+        httpPoolRelease(conn);
         return true;
     } else {
         Serial.println("Server trail refresh failed with code: " + String(httpCode));
     }
-    http.end();
+    httpPoolRelease(conn);
     return false;
 }
 
-// Function to fetch printer status from Moonraker API
-bool fetchPrinterStatus(PrinterInfo &printer) {
-    HTTPClient http;
-    // Moonraker API endpoint - query both webhooks and print_stats to accurately detect printing
-    String url = "http://" + printer.host + "/printer/objects/query?webhooks&print_stats";
-    
-    http.begin(url);
-    http.setTimeout(2000); // 2 second timeout
-    int httpCode = http.GET();
+// Map Moonraker print_stats.state / webhooks.state onto printer.status and detect
+// print completion for the flash animation. Shared by the HTTP poll and the
+// WebSocket subscription; either state may be empty if it is not known yet.
+// Returns false if neither state was usable.
+bool applyPrinterState(PrinterInfo &printer, const String &printState, const String &webhooksState) {
+    String previousStatus = printer.status; // Store previous status to detect transitions
+    
+    // First check print_stats to see if there's an active print
+    // If print_stats shows printing, the printer is definitely printing
+    if (printState == "printing") {
+        printer.status = "printing";
+        printer.lastStatus = printer.status;
+        if (previousStatus != printer.status) {
+            Serial.println("Printer " + printer.name + " status: printing (from print_stats)");
+        }
+        return true;
+    } else if (printState == "paused") {
+        printer.status = "paused";
+        printer.lastStatus = printer.status;
+        if (previousStatus != printer.status) {
+            Serial.println("Printer " + printer.name + " status: paused (from print_stats)");
+        }
+        return true;
+    } else if (printState == "complete") {
+        printer.status = "complete";
+        // Check if we transitioned from printing to complete
+        if (previousStatus == "printing" || printer.lastStatus == "printing") {
+            printer.isFlashing = true;
+            printer.flashStartTime = millis();
+            Serial.println("Printer " + printer.name + " print completed! Starting flash animation.");
+        }
+        printer.lastStatus = printer.status;
+        return true;
+    }
     
-    if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        
-        // Parse JSON response - need larger buffer for print_stats
-        StaticJsonDocument<1024> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+    // If not printing according to print_stats, check webhooks state
+    if (webhooksState.length() == 0) {
+        return false;
+    }
+    String state = webhooksState;
+    // Map Moonraker states to our status
+    if (state == "printing") {
+        printer.status = "printing";
+    } else if (state == "ready" || state == "standby") {
+        printer.status = "ready";
+    } else if (state == "paused") {
+        printer.status = "paused";
+    } else if (state == "error") {
+        printer.status = "error";
+    } else if (state == "idle" || state == "complete" || state == "cancelled") {
+        printer.status = state; // Keep as-is for white color
+        // Check if we transitioned from printing to complete/idle
+        if ((state == "complete" || state == "idle") && (previousStatus == "printing" || printer.lastStatus == "printing")) {
+            printer.isFlashing = true;
+            printer.flashStartTime = millis();
+            Serial.println("Printer " + printer.name + " print completed! Starting flash animation.");
+        }
+    } else {
+        printer.status = state; // Use state as-is for unknown states
+    }
+    if (previousStatus != printer.status) {
+        Serial.println("Printer " + printer.name + " status: " + printer.status + " (raw state: " + state + ")");
+    }
+    printer.lastStatus = printer.status;
+    return true;
+}
+
+// Apply a Moonraker /printer/objects/query?webhooks&print_stats response
+bool applyPrinterResponse(PrinterInfo &printer, const HttpMultiRequest &response) {
+    if (response.status == HTTP_CODE_OK) {
+        // Only the two states are kept; print_stats carries much more
+        static StaticJsonDocument<128> filter;
+        if (filter.isNull()) {
+            filter["result"]["status"]["print_stats"]["state"] = true;
+            filter["result"]["status"]["webhooks"]["state"] = true;
+        }
+        StaticJsonDocument<256> doc;
+        DeserializationError error = deserializeJson(doc, response.body, DeserializationOption::Filter(filter));
         
         if (!error && doc.containsKey("result") && doc["result"].containsKey("status")) {
             JsonObject status = doc["result"]["status"];
-            String state = "unknown";
-            bool isPrinting = false;
-            String previousStatus = printer.status; // Store previous status to detect transitions
-            
-            // First check print_stats to see if there's an active print
-            if (status.containsKey("print_stats")) {
-                JsonObject printStats = status["print_stats"];
-                if (printStats.containsKey("state")) {
-                    String printState = printStats["state"].as<String>();
-                    // If print_stats shows printing, the printer is definitely printing
-                    if (printState == "printing") {
-                        isPrinting = true;
-                        printer.status = "printing";
-                        printer.lastStatus = printer.status;
-                        Serial.println("Printer " + printer.name + " status: printing (from print_stats)");
-                        http.end();
-                        return true;
-                    } else if (printState == "paused") {
-                        printer.status = "paused";
-                        printer.lastStatus = printer.status;
-                        Serial.println("Printer " + printer.name + " status: paused (from print_stats)");
-                        http.end();
-                        return true;
-                    } else if (printState == "complete") {
-                        printer.status = "complete";
-                        // Check if we transitioned from printing to complete
-                        if (previousStatus == "printing" || printer.lastStatus == "printing") {
-                            printer.isFlashing = true;
-                            printer.flashStartTime = millis();
-                            Serial.println("Printer " + printer.name + " print completed! Starting flash animation.");
-                        }
-                        printer.lastStatus = printer.status;
-                        http.end();
-                        return true;
-                    }
-                }
-            }
-            
-            // If not printing according to print_stats, check webhooks state
-            if (status.containsKey("webhooks")) {
-                JsonObject webhooks = status["webhooks"];
-                if (webhooks.containsKey("state")) {
-                    state = webhooks["state"].as<String>();
-                    // Map Moonraker states to our status
-                    if (state == "printing") {
-                        printer.status = "printing";
-                    } else if (state == "ready" || state == "standby") {
-                        printer.status = "ready";
-                    } else if (state == "paused") {
-                        printer.status = "paused";
-                    } else if (state == "error") {
-                        printer.status = "error";
-                    } else if (state == "idle" || state == "complete" || state == "cancelled") {
-                        printer.status = state; // Keep as-is for white color
-                        // Check if we transitioned from printing to complete/idle
-                        if ((state == "complete" || state == "idle") && (previousStatus == "printing" || printer.lastStatus == "printing")) {
-                            printer.isFlashing = true;
-                            printer.flashStartTime = millis();
-                            Serial.println("Printer " + printer.name + " print completed! Starting flash animation.");
-                        }
-                    } else {
-                        printer.status = state; // Use state as-is for unknown states
-                    }
-                    Serial.println("Printer " + printer.name + " status: " + printer.status + " (raw state: " + state + ")");
-                    printer.lastStatus = printer.status;
-                    http.end();
-                    return true;
-                }
-            }
+            String printState = status["print_stats"]["state"] | "";
+            String webhooksState = status["webhooks"]["state"] | "";
+            applyPrinterState(printer, printState, webhooksState);
         } else {
             Serial.println("Failed to parse printer JSON for " + printer.name + ": " + String(error.c_str()));
-            if (error) {
-                Serial.println("Error details: " + String(error.c_str()));
-            }
         }
     } else {
-        Serial.println("HTTP request for printer " + printer.name + " failed with code: " + String(httpCode));
+        Serial.println("HTTP request for printer " + printer.name + " failed with code: " + String(response.status));
         printer.status = "offline";
         printer.lastStatus = printer.status;
     }
-    http.end();
-    return (httpCode == HTTP_CODE_OK);
+    return (response.status == HTTP_CODE_OK);
 }
 
-// Function to update printer status display
-void updatePrinterDisplay() {
+// Function to draw the printer status icon row
+void drawPrinterWidget() {
     unsigned long currentMillis = millis();
     
-    // Get printer icon positions
-    int x1, x2, y;
-    if (currentRotation == 1 || currentRotation == 3) { // Landscape
-        x1 = printerPos.landscape.x1;
-        x2 = printerPos.landscape.x2;
-        y = printerPos.landscape.y;
-    } else { // Portrait
-        x1 = printerPos.portrait.x1;
-        x2 = printerPos.portrait.x2;
-        y = printerPos.portrait.y;
-    }
-    
-    // Handle flashing for Sovol printer
-    uint16_t sovolColor;
-    if (sovolPrinter.isFlashing) {
-        // Check if flash duration has expired
-        if (currentMillis - sovolPrinter.flashStartTime >= PRINTER_FLASH_DURATION) {
-            sovolPrinter.isFlashing = false;
-            sovolColor = getPrinterStatusColor(sovolPrinter.status);
+    // The icon row is one widget, one spacing wide per printer
+    int spacing = screenLayout().printerSpacing;
+    TFT_eSprite &out = beginWidget(WIDGET_PRINTERS);
+    for (int i = 0; i < PRINTER_COUNT; i++) {
+        PrinterInfo &printer = printers[i];
+        uint16_t color;
+        if (printer.isFlashing) {
+            // Check if flash duration has expired
+            if (currentMillis - printer.flashStartTime >= PRINTER_FLASH_DURATION) {
+                printer.isFlashing = false;
+                color = getPrinterStatusColor(printer.status);
+            } else {
+                // Flash between white and status color
+                bool flashOn = ((currentMillis - printer.flashStartTime) / PRINTER_FLASH_INTERVAL) % 2 == 0;
+                color = flashOn ? TFT_WHITE : getPrinterStatusColor(printer.status);
+            }
         } else {
-            // Flash between white and status color
-            bool flashOn = ((currentMillis - sovolPrinter.flashStartTime) / PRINTER_FLASH_INTERVAL) % 2 == 0;
-            sovolColor = flashOn ? TFT_WHITE : getPrinterStatusColor(sovolPrinter.status);
+            color = getPrinterStatusColor(printer.status);
         }
-    } else {
-        sovolColor = getPrinterStatusColor(sovolPrinter.status);
+        iconDraw(out, ICON_PRINTER, i * spacing, 0, color, BACKGROUND);  // Status dot with a white ring
     }
-    drawPrinterIcon(sovolColor, x1, y);
-    
-    // Handle flashing for Mandrain printer
-    uint16_t mandrainColor;
-    if (mandrainPrinter.isFlashing) {
-        // Check if flash duration has expired
-        if (currentMillis - mandrainPrinter.flashStartTime >= PRINTER_FLASH_DURATION) {
-            mandrainPrinter.isFlashing = false;
-            mandrainColor = getPrinterStatusColor(mandrainPrinter.status);
-        } else {
-            // Flash between white and status color
-            bool flashOn = ((currentMillis - mandrainPrinter.flashStartTime) / PRINTER_FLASH_INTERVAL) % 2 == 0;
-            mandrainColor = flashOn ? TFT_WHITE : getPrinterStatusColor(mandrainPrinter.status);
-        }
-    } else {
-        mandrainColor = getPrinterStatusColor(mandrainPrinter.status);
+    pushWidget();
+}
+
+void printStats() {
+    secondTickPrintStats();
+    httpPoolPrintStats();
+    dnsCachePrintStats();
+    serverEvents.printStats();
+    printPrinterLinkStats();
+    printStockStats();
+    snapshotPrintStats();
+    wifiLinkPrintStats();
+    timeSyncPrintStats();
+    regionsPrintStats();
+    printDisplayStats();
+    textRunsPrintStats();
+    iconPackPrintStats();
+    Serial.println("Free heap: " + String(ESP.getFreeHeap()) + " bytes");
+    if (fetchWorkerHandle != NULL) {
+        Serial.println("Fetch worker stack headroom: " + String(uxTaskGetStackHighWaterMark(fetchWorkerHandle)) + " bytes");
     }
-    drawPrinterIcon(mandrainColor, x2, y);
 }
 
 void processSerialInput() {
@@ -1365,91 +1289,23 @@ void processSerialInput() {
         String command = Serial.readStringUntil('\n');
         command.trim();
 
-        if (command.startsWith("timeX ")) {
-            timeXPos = command.substring(6).toInt();
-            updateTimeDisplay();
-        } else if (command.startsWith("dateX ")) {
-            dateXPos = command.substring(6).toInt();
-            updateTimeDisplay();
-        } else if (command.startsWith("weatherX ")) {
-            weatherXPos = command.substring(9).toInt();
-            updateWeatherDisplay();
-        } else if (command.startsWith("iconX ")) {
-            // Icon position now in weatherIconPos matrix - update manually if needed
-            Serial.println("iconX command - use position matrix to modify weatherIconPos");
-            updateWeatherDisplay();
-        } else if (command.startsWith("coffeeStatusX ")) {
-            // Coffee position now in coffeePos matrix - update manually if needed
-            Serial.println("coffeeStatusX command - use position matrix to modify coffeePos");
-            updateCoffeeMachineDisplay();
+        if (command.startsWith("timeX ") || command.startsWith("dateX ") || command.startsWith("weatherX ") ||
+            command.startsWith("iconX ") || command.startsWith("coffeeStatusX ")) {
+            // Positions are compiled in so overlaps are caught at build time
+            Serial.println(command.substring(0, command.indexOf(' ')) + " command - edit the LAYOUT tables to move widgets");
+        } else if (command == "stats") {
+            printStats();
+        } else if (command == "boot") {
+            Serial.println("Boot timeline:");
+            printBootTimeline();
+        } else if (command == "health") {
+            requestHealthReport();
         } else if (command.startsWith("coffeeTimeX ")) {
-            // Coffee time position now in coffeePos matrix - update manually if needed
-            Serial.println("coffeeTimeX command - use position matrix to modify coffeePos");
-            updateCoffeeMachineDisplay();
+            Serial.println("coffeeTimeX command - edit the LAYOUT tables to move widgets");
         }
     }
 }
 
-// Function to calculate DST offset based on current date
-// US DST: Second Sunday in March to First Sunday in November
-// Simplified: March-October = EDT (UTC-4), November-February = EST (UTC-5)
-// Note: Uses epoch time to determine month since NTPClient doesn't have date methods
-int getDSTOffset() {
-    // Save current offset to restore later (use cached value since NTPClient doesn't have getTimeOffset)
-    int savedOffset = cachedDSTOffset;
-    
-    // Get UTC time first to determine month (need UTC to accurately determine DST period)
-    timeClient.setTimeOffset(0);
-    timeClient.update();
-    
-    // Get epoch time and calculate month
-    unsigned long epochTime = timeClient.getEpochTime();
-    
-    // Restore original offset
-    timeClient.setTimeOffset(savedOffset);
-    
-    // Calculate month from epoch time
-    // January 1, 1970 (Unix epoch) was a Thursday
-    // Calculate days since epoch, then approximate month
-    // This is approximate but sufficient for DST detection
-    int daysSinceEpoch = epochTime / 86400;
-    
-    // Approximate month calculation (accounting for leap years roughly)
-    // Average days per month ≈ 30.44
-    // Calculate which "30-day month" we're in, accounting for years
-    int yearsSinceEpoch = daysSinceEpoch / 365; // Rough years
-    int leapDays = yearsSinceEpoch / 4; // Approximate leap days
-    int adjustedDays = daysSinceEpoch - (yearsSinceEpoch * 365 + leapDays);
-    int month = (adjustedDays / 30) + 1;
-    
-    // Normalize month (1-12)
-    if (month > 12) month = ((month - 1) % 12) + 1;
-    if (month < 1) month = 12;
-    
-    // More accurate: use day of year to better approximate month
-    // Days 0-59 ≈ Jan-Feb, 60-89 ≈ Mar, 90-119 ≈ Apr, etc.
-    int dayOfYear = adjustedDays % 365;
-    if (dayOfYear < 60) month = (dayOfYear < 31) ? 1 : 2;
-    else if (dayOfYear < 90) month = 3;
-    else if (dayOfYear < 120) month = 4;
-    else if (dayOfYear < 151) month = 5;
-    else if (dayOfYear < 181) month = 6;
-    else if (dayOfYear < 212) month = 7;
-    else if (dayOfYear < 243) month = 8;
-    else if (dayOfYear < 273) month = 9;
-    else if (dayOfYear < 304) month = 10;
-    else if (dayOfYear < 334) month = 11;
-    else month = 12;
-    
-    // DST period: March (3) to October (10) is EDT (UTC-4)
-    // Outside this period is EST (UTC-5)
-    if (month >= 3 && month <= 10) {
-        return -4 * 3600; // EDT (UTC-4)
-    } else {
-        return -5 * 3600; // EST (UTC-5)
-    }
-}
-
 // Function to fetch time from local server (timezone-aware)
 bool fetchTimeFromLocalServer() {
     HTTPClient http;
@@ -1457,14 +1313,20 @@ bool fetchTimeFromLocalServer() {
     
     http.begin(url);
     http.setTimeout(2000); // Reduced to 2 second timeout to minimize blocking
+    httpCollectResponseHeaders(http);
     int httpCode = http.GET();
     
     if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        
-        // Parse JSON response
-        StaticJsonDocument<300> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+        // Parse straight from the socket, keeping only the fields of either format
+        static StaticJsonDocument<64> filter;
+        if (filter.isNull()) {
+            filter["time"] = true;
+            filter["hours"] = true;
+            filter["minutes"] = true;
+            filter["seconds"] = true;
+        }
+        StaticJsonDocument<128> doc;
+        DeserializationError error = httpParseJsonBody(http, doc, filter);
         
         if (!error) {
             // Try different possible JSON formats
@@ -1510,147 +1372,133 @@ bool fetchTimeFromLocalServer() {
     return false;
 }
 
-// Function to fetch time from NTP with DST handling
-bool fetchTimeFromNTP() {
-    unsigned long currentMillis = millis();
-    
-    // Update DST offset periodically (not every call, to reduce overhead)
-    if (currentMillis - lastDSTCheck >= DST_CHECK_INTERVAL || lastDSTCheck == 0) {
-        cachedDSTOffset = getDSTOffset();
-        timeClient.setTimeOffset(cachedDSTOffset);
-        lastDSTCheck = currentMillis;
-        Serial.println("DST offset updated to: " + String(cachedDSTOffset/3600) + " hours");
-    }
-    
-    timeClient.update();
-    
-    // Get time components
-    int hours = timeClient.getHours();
-    int minutes = timeClient.getMinutes();
-    int seconds = timeClient.getSeconds();
+// Function to read time and date for the given second in the local zone.
+// SNTP keeps the clock in sync in the background, so this never touches the network
+bool fetchTimeFromClock(time_t second) {
+    CivilTime now = civilTimeFromUtc(second);
     
     // Format time string with leading zeros (24-hour format)
-    currentTime.time = (hours < 10 ? "0" : "") + String(hours) + ":" +
-                      (minutes < 10 ? "0" : "") + String(minutes);
-    currentTime.seconds = (seconds < 10 ? "0" : "") + String(seconds);
+    currentTime.time = (now.hour < 10 ? "0" : "") + String(now.hour) + ":" +
+                      (now.minute < 10 ? "0" : "") + String(now.minute);
+    currentTime.seconds = (now.second < 10 ? "0" : "") + String(now.second);
+    currentTime.date = civilFormatDate(now);
     
     return true;
 }
 
 // Function to fetch time from API (tries local server first, falls back to NTP)
-bool fetchTime() {
+bool fetchTime(time_t second) {
     // Try local server first (timezone-aware)
-    if (useLocalServerTime && WiFi.status() == WL_CONNECTED) {
+    if (useLocalServerTime && wifiLinkUp()) {
         if (fetchTimeFromLocalServer()) {
+            // The server only sends the time; the date still comes from the clock
+            currentTime.date = civilFormatDate(civilTimeFromUtc(second));
             return true;
         }
     }
     
-    // Fall back to NTP with DST handling
-    return fetchTimeFromNTP();
+    // Fall back to the SNTP-synced clock
+    return fetchTimeFromClock(second);
 }
 
-// Function to fetch date from API
-bool fetchDate() {
-    HTTPClient http;
-    String url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/date";
-    
-    http.begin(url);
-    int httpCode = http.GET();
-    
-    if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        
-        // Parse JSON response
-        StaticJsonDocument<200> doc;
-        DeserializationError error = deserializeJson(doc, payload);
-        
-        if (!error) {
-            const char* date = doc["date"];
-            currentTime.date = String(date); // Store date separately (with year, will be removed during display)
-            Serial.println("Extracted date: " + currentTime.date); // Debug statement
-            http.end();
-            return true;
-        } else {
-            Serial.println("Failed to parse date JSON: " + String(error.c_str())); // Debug statement
-        }
-    } else {
-        Serial.println("HTTP request for date failed with code: " + String(httpCode)); // Debug statement
-    }
-    http.end();
-    return false;
+// Copy weather fields from a parsed /api/weather/current object
+void parseWeatherJson(JsonVariantConst json, WeatherInfo &weather) {
+    weather.conditions = json["conditions"].as<String>();
+    weather.temperature = json["temperature"].as<int>();
+    weather.feels_like = json["feels_like"].as<int>();
+    weather.humidity = json["humidity"].as<int>();
+    weather.icon = iconFromWeatherCode(json["icon"].as<String>());
+}
+
+// Select the fields parseWeatherJson reads
+void addWeatherFilter(JsonObject filter) {
+    filter["conditions"] = true;
+    filter["temperature"] = true;
+    filter["feels_like"] = true;
+    filter["humidity"] = true;
+    filter["icon"] = true;
 }
 
 // Function to fetch weather from API
-bool fetchWeather() {
-    HTTPClient http;
-    String url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/weather/current";
-    
-    http.begin(url);
-    int httpCode = http.GET();
+FetchStatus fetchWeather(WeatherInfo &weather) {
+    PooledConnection *conn = httpPoolAcquire(serverHost, serverPort, "/api/weather/current");
+    if (conn == NULL) {
+        return FETCH_FAILED;
+    }
+    int httpCode = httpPoolSend(conn, "GET");
     
     if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        
-        // Parse JSON response
-        StaticJsonDocument<400> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+        // Parse straight from the socket, keeping only the fields we display
+        static StaticJsonDocument<128> filter;
+        if (filter.isNull()) {
+            addWeatherFilter(filter.to<JsonObject>());
+        }
+        StaticJsonDocument<256> doc;
+        DeserializationError error = httpParseJsonBody(conn->http, doc, filter);
         
         if (!error) {
-            currentWeather.conditions = doc["conditions"].as<String>();
-            currentWeather.temperature = doc["temperature"].as<int>();
-            currentWeather.feels_like = doc["feels_like"].as<int>();
-            currentWeather.humidity = doc["humidity"].as<int>();
-            currentWeather.icon = doc["icon"].as<String>();
-            Serial.println("Extracted weather: " + currentWeather.conditions); // Debug statement
-            http.end();
-            return true;
+            parseWeatherJson(doc, weather);
+            Serial.println("Extracted weather: " + weather.conditions); // Debug statement
+            httpPoolCacheValidators(conn);
+            httpPoolRelease(conn);
+            return FETCH_UPDATED;
         } else {
             Serial.println("Failed to parse weather JSON: " + String(error.c_str())); // Debug statement
         }
+    } else if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        // Unchanged since the last successful fetch; 304 has no body
+        httpPoolRelease(conn);
+        return FETCH_NOT_MODIFIED;
     } else {
         Serial.println("HTTP request for weather failed with code: " + String(httpCode)); // Debug statement
     }
-    http.end();
-    return false;
+    httpPoolRelease(conn);
+    return FETCH_FAILED;
 }
 
 // Function to fetch weather forecast (today and tomorrow) from API
-bool fetchForecast() {
-    HTTPClient http;
-    String url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/weather/forecast";
-
-    http.begin(url);
-    http.setTimeout(5000);  // 5 second timeout
-    int httpCode = http.GET();
+bool fetchForecast(ForecastInfo &forecast) {
+    PooledConnection *conn = httpPoolAcquire(serverHost, serverPort, "/api/weather/forecast", 5000);  // 5 second timeout
+    if (conn == NULL) {
+        return false;
+    }
+    int httpCode = httpPoolSend(conn, "GET");
 
     if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-
-        // Parse JSON response - expecting array of forecast days
+        // Parse straight from the socket - expecting array of forecast days,
+        // the filter applies to every element
+        static StaticJsonDocument<128> filter;
+        if (filter.isNull()) {
+            JsonObject day = filter.add<JsonObject>();
+            day["date"] = true;
+            day["high"] = true;
+            day["low"] = true;
+            day["conditions"] = true;
+            day["icon"] = true;
+        }
         StaticJsonDocument<1024> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+        DeserializationError error = httpParseJsonBody(conn->http, doc, filter);
 
         if (!error) {
             JsonArray forecasts = doc.as<JsonArray>();
             if (forecasts.size() >= 2) {
                 // Today's forecast
-                weatherForecast.today.date = forecasts[0]["date"].as<String>();
-                weatherForecast.today.high = forecasts[0]["high"].as<int>();
-                weatherForecast.today.low = forecasts[0]["low"].as<int>();
-                weatherForecast.today.conditions = forecasts[0]["conditions"].as<String>();
-                weatherForecast.today.icon = forecasts[0]["icon"].as<String>();
+                forecast.today.date = forecasts[0]["date"].as<String>();
+                forecast.today.high = forecasts[0]["high"].as<int>();
+                forecast.today.low = forecasts[0]["low"].as<int>();
+                forecast.today.conditions = forecasts[0]["conditions"].as<String>();
+                forecast.today.icon = iconFromWeatherCode(forecasts[0]["icon"].as<String>());
 
                 // Tomorrow's forecast
-                weatherForecast.tomorrow.date = forecasts[1]["date"].as<String>();
-                weatherForecast.tomorrow.high = forecasts[1]["high"].as<int>();
-                weatherForecast.tomorrow.low = forecasts[1]["low"].as<int>();
-                weatherForecast.tomorrow.conditions = forecasts[1]["conditions"].as<String>();
-                weatherForecast.tomorrow.icon = forecasts[1]["icon"].as<String>();
+                forecast.tomorrow.date = forecasts[1]["date"].as<String>();
+                forecast.tomorrow.high = forecasts[1]["high"].as<int>();
+                forecast.tomorrow.low = forecasts[1]["low"].as<int>();
+                forecast.tomorrow.conditions = forecasts[1]["conditions"].as<String>();
+                forecast.tomorrow.icon = iconFromWeatherCode(forecasts[1]["icon"].as<String>());
 
-                weatherForecast.valid = true;
+                forecast.valid = true;
                 Serial.println("Forecast fetched successfully");
-                http.end();
+                httpPoolRelease(conn);
                 return true;
             }
         } else {
@@ -1659,9 +1507,12 @@ bool fetchForecast() {
     } else {
         Serial.println("HTTP request for forecast failed with code: " + String(httpCode));
     }
-    http.end();
+    httpPoolRelease(conn);
+    return false;
+}
 
-    // Fallback: Use current weather data for "today" if forecast endpoint unavailable
+// Fallback: Use current weather data for "today" if forecast endpoint unavailable
+bool setForecastFallback() {
     if (currentWeather.conditions.length() > 0) {
         Serial.println("Using current weather as fallback for forecast");
         weatherForecast.today.date = "Today";
@@ -1675,7 +1526,7 @@ bool fetchForecast() {
         weatherForecast.tomorrow.high = 0;
         weatherForecast.tomorrow.low = 0;
         weatherForecast.tomorrow.conditions = "Forecast unavailable";
-        weatherForecast.tomorrow.icon = "";
+        weatherForecast.tomorrow.icon = ICON_NONE;
 
         weatherForecast.valid = true;
         return true;
@@ -1685,583 +1536,1533 @@ bool fetchForecast() {
     return false;
 }
 
+// Copy coffee machine fields from a parsed /api/coffee/status object
+void parseCoffeeJson(JsonVariantConst json, CoffeeMachineInfo &coffee) {
+    coffee.status = json["status"].as<String>();
+    coffee.scheduledTime = json["time"].as<String>();
+    coffee.esp32Status = json["esp32_status"].as<String>();
+}
+
+// Select the fields parseCoffeeJson reads
+void addCoffeeFilter(JsonObject filter) {
+    filter["status"] = true;
+    filter["time"] = true;
+    filter["esp32_status"] = true;
+}
+
 // Function to fetch coffee machine status from API
-bool fetchCoffeeMachineStatus() {
-    HTTPClient http;
-    String url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/coffee/status";
-    
-    http.begin(url);
-    int httpCode = http.GET();
+FetchStatus fetchCoffeeMachineStatus(CoffeeMachineInfo &coffee) {
+    PooledConnection *conn = httpPoolAcquire(serverHost, serverPort, "/api/coffee/status");
+    if (conn == NULL) {
+        return FETCH_FAILED;
+    }
+    int httpCode = httpPoolSend(conn, "GET");
     
     if (httpCode == HTTP_CODE_OK) {
-        String payload = http.getString();
-        
-        // Parse JSON response
-        StaticJsonDocument<200> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+        // Parse straight from the socket, keeping only the fields we display
+        static StaticJsonDocument<64> filter;
+        if (filter.isNull()) {
+            addCoffeeFilter(filter.to<JsonObject>());
+        }
+        StaticJsonDocument<256> doc;
+        DeserializationError error = httpParseJsonBody(conn->http, doc, filter);
         
         if (!error) {
-            coffeeMachine.status = doc["status"].as<String>();
-            coffeeMachine.scheduledTime = doc["time"].as<String>();
-            coffeeMachine.esp32Status = doc["esp32_status"].as<String>();
-            
-            // Track the scheduled time when coffee is on, for auto-schedule feature
-            if (coffeeMachine.status == "On" && coffeeMachine.scheduledTime.length() > 0) {
-                lastCoffeeScheduledTime = coffeeMachine.scheduledTime;
-            }
-            
-            Serial.println("Extracted coffee machine status: " + coffeeMachine.status); // Debug statement
-            http.end();
-            return true;
+            parseCoffeeJson(doc, coffee);
+            Serial.println("Extracted coffee machine status: " + coffee.status); // Debug statement
+            httpPoolCacheValidators(conn);
+            httpPoolRelease(conn);
+            return FETCH_UPDATED;
         } else {
             Serial.println("Failed to parse coffee machine JSON: " + String(error.c_str())); // Debug statement
         }
+    } else if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        // Unchanged since the last successful fetch; 304 has no body
+        httpPoolRelease(conn);
+        return FETCH_NOT_MODIFIED;
     } else {
         Serial.println("HTTP request for coffee machine status failed with code: " + String(httpCode)); // Debug statement
     }
-    http.end();
-    return false;
+    httpPoolRelease(conn);
+    return FETCH_FAILED;
 }
 
 // Function to set coffee machine schedule via API
 bool setCoffeeSchedule(String time) {
-    HTTPClient http;
-    String url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/coffee/on?time=" + time;
-    
-    http.begin(url);
-    http.setTimeout(3000);  // 3 second timeout
+    PooledConnection *conn = httpPoolAcquire(serverHost, serverPort, "/api/coffee/on?time=" + time, 3000);  // 3 second timeout
+    if (conn == NULL) {
+        return false;
+    }
     
-    int httpCode = http.POST("");  // Empty body, time is in URL parameter
+    int httpCode = httpPoolSend(conn, "POST");  // Empty body, time is in URL parameter
     
     if (httpCode == HTTP_CODE_OK || httpCode == 201) {
         Serial.println("Coffee schedule set to: " + time);
-        http.end();
+        httpPoolRelease(conn);
         return true;
     } else {
         Serial.println("Failed to set coffee schedule. HTTP code: " + String(httpCode));
     }
-    http.end();
+    httpPoolRelease(conn);
     return false;
 }
 
-// Function to toggle coffee machine on/off
-bool toggleCoffeeMachine() {
-    HTTPClient http;
-    String url;
+// Function to switch coffee machine on (optionally at a scheduled time) or off via API
+bool sendCoffeeCommand(bool turnOn, const String &time) {
+    String path;
     
-    // If coffee is currently on, turn it off
-    if (coffeeMachine.status == "On") {
-        url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/coffee/off";
+    if (!turnOn) {
+        path = "/api/coffee/off";
         Serial.println("Turning coffee machine OFF");
+    } else if (time.length() > 0) {
+        path = "/api/coffee/on?time=" + time;
+        Serial.println("Turning coffee machine ON with time: " + time);
     } else {
-        // If off, turn it on with the last scheduled time (or activate immediately if no time)
-        if (lastCoffeeScheduledTime.length() > 0) {
-            url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/coffee/on?time=" + lastCoffeeScheduledTime;
-            Serial.println("Turning coffee machine ON with time: " + lastCoffeeScheduledTime);
-        } else {
-            url = "http://" + String(serverHost) + ":" + String(serverPort) + "/api/coffee/on";
-            Serial.println("Activating coffee machine immediately");
-        }
+        path = "/api/coffee/on";
+        Serial.println("Activating coffee machine immediately");
     }
     
-    http.begin(url);
-    http.setTimeout(3000);  // 3 second timeout
+    PooledConnection *conn = httpPoolAcquire(serverHost, serverPort, path, 3000);  // 3 second timeout
+    if (conn == NULL) {
+        return false;
+    }
     
-    int httpCode = http.POST("");
+    int httpCode = httpPoolSend(conn, "POST");
     
     if (httpCode == HTTP_CODE_OK || httpCode == 201) {
         Serial.println("Coffee machine toggle successful");
-        // Update display immediately
-        if (fetchCoffeeMachineStatus()) {
-            updateCoffeeMachineDisplay();
-        }
-        http.end();
+        httpPoolRelease(conn);
         return true;
     } else {
         Serial.println("Failed to toggle coffee machine. HTTP code: " + String(httpCode));
     }
-    http.end();
+    httpPoolRelease(conn);
     return false;
 }
 
-void setDummyStockData() {
-    spyStock.symbol = "SPY";
-    spyStock.price = 495.28;
-    spyStock.change = 2.34;
-    spyStock.changePercent = 0.47;
-    Serial.println("Using dummy SPY data");
+// Long-lived TLS connection to the quote host (worker task only). The client and
+// its mbedTLS context stay allocated between polls, so while Yahoo keeps the
+// socket open a poll skips the TCP connect and the TLS handshake entirely.
+const char *stockHost = "query1.finance.yahoo.com";
+const char *stockPath = "/v8/finance/chart/SPY";  // Yahoo Finance API endpoint - no key required
+WiFiClientSecure stockClient;
+HTTPClient stockHttp;
+bool stockHttpBound = false;  // begin() has been called on stockHttp
+
+// Timing of the last stock fetch, for the "stats" command (ms)
+struct StockFetchTiming {
+    unsigned long dns;        // Host lookup (cached after the first poll)
+    unsigned long handshake;  // TCP connect + TLS handshake, 0 when the socket was reused
+    unsigned long firstByte;  // Request sent until response headers parsed
+    unsigned long parse;      // Streaming JSON parse and body drain
+    bool reused;
+} lastStockTiming = {};
+unsigned long stockHandshakes = 0;
+unsigned long stockReuses = 0;
+
+// Open the quote socket to the cached address; SNI still carries the host name
+bool connectStockClient(StockFetchTiming &timing) {
+    IPAddress ip;
+    unsigned long start = millis();
+    if (!dnsCacheResolve(stockHost, ip)) {
+        return false;
+    }
+    timing.dns = millis() - start;
+
+    start = millis();
+    bool ok = stockClient.connect(ip, 443, stockHost, NULL, NULL, NULL);
+    timing.handshake = millis() - start;
+    if (!ok) {
+        dnsCacheInvalidate(stockHost);
+        return false;
+    }
+    stockHandshakes++;
+    return true;
 }
 
-// Function to fetch stock price from Alpha Vantage API
-bool fetchStockPrice() {
-    WiFiClientSecure *client = new WiFiClientSecure;
-    if(client) {
-        client->setInsecure();
-        
-        HTTPClient http;
-        // Yahoo Finance API endpoint - no key required
-        String url = "https://query1.finance.yahoo.com/v8/finance/chart/SPY";
-        
-        Serial.println("Fetching SPY price from Yahoo Finance...");
-        http.begin(*client, url);
-        http.setTimeout(3000);  // Reduced from 10000 to 3000ms to minimize blocking
-        
-        int httpCode = http.GET();
-        
-        if (httpCode == HTTP_CODE_OK) {
-            String payload = http.getString();
-            
-            // Parse JSON response - Yahoo Finance format
-            StaticJsonDocument<2048> doc; // Larger buffer for Yahoo response
-            DeserializationError error = deserializeJson(doc, payload);
-            
-            if (!error && doc.containsKey("chart") && doc["chart"]["result"][0]["meta"].containsKey("regularMarketPrice")) {
-                JsonObject result = doc["chart"]["result"][0];
-                JsonObject meta = result["meta"];
-                
-                spyStock.symbol = "SPY";
-                spyStock.price = meta["regularMarketPrice"].as<float>();
-                
-                // Calculate change
-                float previousClose = meta["previousClose"].as<float>();
-                spyStock.change = spyStock.price - previousClose;
-                spyStock.changePercent = (spyStock.change / previousClose) * 100;
-                
-                http.end();
-                delete client;
-                return true;
-            } else {
-                Serial.println("Failed to parse Yahoo Finance data");
-                setDummyStockData();
-                http.end();
-                delete client;
-                return true;
+// Function to fetch stock price from Yahoo Finance
+bool fetchStockPrice(StockInfo &stock) {
+    StockFetchTiming timing = {};
+    
+    Serial.println("Fetching SPY price from Yahoo Finance...");
+    if (!stockHttpBound) {
+        stockClient.setInsecure();
+        stockHttp.begin(stockClient, stockHost, 443, stockPath, true);
+        stockHttp.setReuse(true);
+        stockHttp.setTimeout(3000);  // Reduced from 10000 to 3000ms to minimize blocking
+        stockHttpBound = true;
+    }
+    
+    if (!breakerAllow(stockHost)) {
+        Serial.println("Stock quote host circuit open, skipping fetch");
+        return false;
+    }
+
+    // Reuse the open socket; if Yahoo closed it while idle, reconnect once
+    timing.reused = stockClient.connected();
+    int httpCode = HTTPC_ERROR_CONNECTION_REFUSED;
+    for (int attempt = 0; attempt < 2; attempt++) {
+        if (!stockClient.connected()) {
+            stockClient.stop();
+            timing.reused = false;
+            if (!connectStockClient(timing)) {
+                break;
             }
-        } else {
-            setDummyStockData();
-            http.end();
-            delete client;
-            return true;
         }
-    }
-    
-    setDummyStockData();
-    return true;
-}
-// Add this function before setup()
-void handleRotation() {
-    static bool lastButtonState = HIGH;
-    unsigned long currentTime = millis();
-    
-    bool currentButtonState = digitalRead(BUTTON_PIN);
-    
-    if (currentButtonState == LOW && lastButtonState == HIGH) {
-        if (currentTime - lastButtonPress >= DEBOUNCE_DELAY) {
-            lastButtonPress = currentTime;
-            currentRotation = (currentRotation + 1) % 4;
-            tft.setRotation(currentRotation);
-            
-            // Force complete refresh of display
-            tft.fillScreen(BACKGROUND);
-            lastTime = "";  // Reset cached values to force redraw
-            lastSeconds = "";
-            lastDate = "";
-            lastStockDisplay = "";  // Reset stock cache
-            updateTimeDisplay();
-            updateStockDisplay();
-            updateWeatherDisplay();
-            updateCoffeeMachineDisplay();
-            updateTrailDisplay();
-            // updateCountdownDisplay();  // Hidden for now
-            updatePrinterDisplay();
-            drawWeatherIconStatic();  // Draw static weather icon
+        httpCollectResponseHeaders(stockHttp);  // Forget the last response's headers
+        unsigned long start = millis();
+        httpCode = stockHttp.GET();
+        timing.firstByte = millis() - start;
+        if (httpCode >= 0 || !timing.reused) {
+            break;
         }
+        stockClient.stop();  // Dead keep-alive socket
     }
-    
-    lastButtonState = currentButtonState;
-}
-
-void handleScreenToggle() {
-    static bool lastToggleState = HIGH;
-    static unsigned long lastPressTime = 0;
-    static bool waitingForDoublePress = false;
-    const unsigned long DOUBLE_PRESS_WINDOW = 400;  // 400ms window for double press
-    
-    unsigned long currentTime = millis();
-    bool currentToggleState = digitalRead(SCREEN_TOGGLE_PIN);
-    
-    // Detect button press (LOW = pressed)
-    if (currentToggleState == LOW && lastToggleState == HIGH) {
-        if (currentTime - lastScreenToggle >= DEBOUNCE_DELAY) {
-            lastScreenToggle = currentTime;
-            
-            // Check if this is within the double-press window
-            if (waitingForDoublePress && (currentTime - lastPressTime) < DOUBLE_PRESS_WINDOW) {
-                // Double press detected - Toggle coffee machine
-                waitingForDoublePress = false;
-                Serial.println("Double press detected - Toggling coffee machine");
-                toggleCoffeeMachine();
-            } else {
-                // First press - start waiting for potential double press
-                waitingForDoublePress = true;
-                lastPressTime = currentTime;
-            }
-        }
+    if (timing.reused) {
+        stockReuses++;
     }
+    breakerRecord(stockHost, httpCode);
     
-    // Check if double-press window expired (single press confirmed)
-    if (waitingForDoublePress && (currentTime - lastPressTime) >= DOUBLE_PRESS_WINDOW) {
-        waitingForDoublePress = false;
-        
-        // Single press - Toggle screen ON/OFF
-        isScreenOn = !isScreenOn;
+    bool success = false;
+    if (httpCode == HTTP_CODE_OK) {
+        // The chart response carries the full intraday series; parse straight
+        // from the socket and keep only the two quote fields we display
+        static StaticJsonDocument<128> filter;
+        if (filter.isNull()) {
+            JsonObject meta = filter["chart"]["result"][0]["meta"].to<JsonObject>();
+            meta["regularMarketPrice"] = true;
+            meta["previousClose"] = true;
+        }
+        StaticJsonDocument<256> doc;
+        unsigned long start = millis();
+        DeserializationError error = httpParseJsonBody(stockHttp, doc, filter);
+        timing.parse = millis() - start;
         
-        if (isScreenOn) {
-            // Turn screen ON
-            digitalWrite(TFT_BL, HIGH);  // Turn on backlight
+        if (!error && doc["chart"]["result"][0]["meta"].containsKey("regularMarketPrice")) {
+            JsonObject meta = doc["chart"]["result"][0]["meta"];
             
-            // Refresh everything - reset cache to force redraw
-            tft.fillScreen(BACKGROUND);
-            lastTime = "";  // Reset cached values to force redraw
-            lastSeconds = "";
-            lastDate = "";
-            lastStockDisplay = "";  // Reset stock cache
-            updateTimeDisplay();
-            updateStockDisplay();
-            updateWeatherDisplay();
-            updateCoffeeMachineDisplay();
-            updateTrailDisplay();
-            // updateCountdownDisplay();  // Hidden for now
-            updatePrinterDisplay();
-            drawWeatherIconStatic();  // Draw static weather icon
+            stock.symbol = "SPY";
+            stock.price = meta["regularMarketPrice"].as<float>();
             
-            Serial.println("Single press - Screen ON");
+            // Calculate change
+            float previousClose = meta["previousClose"].as<float>();
+            stock.change = stock.price - previousClose;
+            stock.changePercent = previousClose != 0 ? (stock.change / previousClose) * 100 : 0;
+            success = true;
         } else {
-            // Turn screen OFF
-            digitalWrite(TFT_BL, LOW);   // Turn off backlight
-            
-            // AUTO-SCHEDULE FEATURE: When screen turns off, set coffee to last scheduled time
-            if (lastCoffeeScheduledTime.length() > 0) {
-                Serial.println("Auto-scheduling coffee to: " + lastCoffeeScheduledTime);
-                if (setCoffeeSchedule(lastCoffeeScheduledTime)) {
-                    Serial.println("Coffee auto-schedule successful");
-                } else {
-                    Serial.println("Coffee auto-schedule failed");
-                }
-            } else {
-                Serial.println("No previous coffee schedule time available for auto-schedule");
-            }
-            
-            Serial.println("Single press - Screen OFF");
+            Serial.println("Failed to parse Yahoo Finance data: " + String(error.c_str()));
         }
+    } else {
+        Serial.println("HTTP request for stock price failed with code: " + String(httpCode));
     }
     
-    lastToggleState = currentToggleState;
+    // end() keeps the socket open when Yahoo allowed keep-alive
+    stockHttp.end();
+    if (!stockClient.connected()) {
+        // HTTPClient dropped its client pointer when it closed the socket; begin() again next poll
+        stockClient.stop();
+        stockHttpBound = false;
+    }
+    
+    lastStockTiming = timing;
+    Serial.println("Stock fetch: dns " + String(timing.dns) + "ms, connect+TLS " + String(timing.handshake) +
+                   "ms, first byte " + String(timing.firstByte) + "ms, parse " + String(timing.parse) + "ms" +
+                   (timing.reused ? " (reused connection)" : ""));
+    return success;
 }
 
-void handleRefresh() {
-    static bool lastRefreshState = HIGH;
-    unsigned long currentTime = millis();
-    bool currentRefreshState = digitalRead(REFRESH_PIN);
+void printStockStats() {
+    Serial.println("Stock TLS: " + String(stockHandshakes) + " handshakes, " + String(stockReuses) + " reused; last fetch" +
+                   " dns " + String(lastStockTiming.dns) + "ms, connect+TLS " + String(lastStockTiming.handshake) +
+                   "ms, first byte " + String(lastStockTiming.firstByte) + "ms, parse " + String(lastStockTiming.parse) + "ms");
+}
 
-    // Button just pressed (transition from HIGH to LOW)
-    if (currentRefreshState == LOW && lastRefreshState == HIGH) {
-        if (currentTime - lastRefreshPress >= DEBOUNCE_DELAY) {
-            refreshHoldStart = currentTime;  // Start tracking hold time
-            Serial.println("Refresh button pressed - hold for forecast view");
-        }
-    }
+// ============================================================================
+// FETCH WORKER - all HTTP I/O runs on core 0, rendering stays on core 1
+// ============================================================================
+// The worker owns every network fetch and posts parsed data back to loop()
+// through fetchResultQueue. Only loop() touches the display and the global
+// widget structs, so no locking is needed around them.
+
+// Requests loop() can send to the worker (button presses)
+enum FetchRequestType : uint8_t {
+    REQUEST_REFRESH_ALL,      // Manual refresh: force server trail refresh, then fetch everything
+    REQUEST_FORECAST,         // Forecast view opened
+    REQUEST_COFFEE_ON,        // Turn coffee on (arg = scheduled time, may be empty)
+    REQUEST_COFFEE_OFF,       // Turn coffee off
+    REQUEST_COFFEE_SCHEDULE,  // Set coffee schedule (arg = time), no status refetch
+    REQUEST_PRINT_HEALTH      // "health" serial command: circuit breakers and job backoff
+};
 
-    // Button is being held down
-    if (currentRefreshState == LOW && refreshHoldStart > 0) {
-        unsigned long holdDuration = currentTime - refreshHoldStart;
+struct FetchRequest {
+    FetchRequestType type;
+    char arg[16];  // Plain char array so the request can be copied into a FreeRTOS queue
+};
 
-        // If held long enough and not already showing forecast, show it
-        if (holdDuration >= HOLD_THRESHOLD && !isShowingForecast) {
-            isShowingForecast = true;
-            Serial.println("Hold detected - showing forecast view");
+// Bits in FetchResult::fields / FetchResult::failed
+#define RESULT_WEATHER   (1 << 1)
+#define RESULT_FORECAST  (1 << 2)
+#define RESULT_COFFEE    (1 << 3)
+#define RESULT_TRAILS    (1 << 4)
+#define RESULT_STOCK     (1 << 5)
+#define RESULT_PRINTERS  (1 << 6)
+#define RESULT_PERIODIC  (RESULT_WEATHER | RESULT_COFFEE | RESULT_TRAILS | RESULT_STOCK | RESULT_PRINTERS)
+
+// Parsed data handed from the worker to loop(). Allocated by the worker and
+// deleted by loop() once applied; only the pointer travels through the queue.
+struct FetchResult {
+    uint16_t fields;  // RESULT_* bits fetched successfully
+    uint16_t failed;  // RESULT_* bits attempted but failed
+    WeatherInfo weather;
+    ForecastInfo forecast;
+    CoffeeMachineInfo coffee;
+    TrailInfo trails[3];  // Momba, John Bryan, Caesar Creek
+    StockInfo stock;
+    PrinterInfo printers[PRINTER_COUNT];  // printerConfig order
+};
 
-            // Fetch forecast data and display
-            fetchForecast();
-            drawForecastView();
-        }
+const UBaseType_t FETCH_REQUEST_QUEUE_LENGTH = 8;
+const UBaseType_t FETCH_RESULT_QUEUE_LENGTH = 4;
+const uint32_t FETCH_WORKER_STACK_SIZE = 12288;  // TLS handshake for the stock quote needs a deep stack
+const BaseType_t FETCH_WORKER_CORE = 0;  // Wi-Fi stack core; loop() runs on core 1
+const unsigned long FETCH_WORKER_IDLE_MS = 100;  // Max sleep between push channel polls
+const unsigned long FETCH_RETRY_DELAY = 10000;   // First retry of a failed periodic fetch; doubles per failure
+
+// Worker-side printer copies (status transitions are detected against these)
+PrinterInfo workerPrinters[PRINTER_COUNT];
+
+// Moonraker WebSocket per printer. Once printer.objects.subscribe is confirmed,
+// notify_status_update deltas keep workerPrinters current and that printer is
+// no longer polled; polling resumes as soon as the socket drops.
+struct PrinterLink {
+    WebSocketClient socket;
+    String printState;     // Last known print_stats.state (deltas only carry changes)
+    String webhooksState;  // Last known webhooks.state
+    bool subscribed;       // Subscription confirmed, deltas are flowing
+};
+PrinterLink printerLinks[PRINTER_COUNT];
+const int PRINTER_SUBSCRIBE_ID = 1;  // JSON-RPC id of the subscribe request
+const unsigned long PRINTER_POLL_TIMEOUT = 2000;  // Shared deadline for one parallel printer poll
+
+// Server-side trail ids, in FetchResult::trails order
+const char *trailIds[3] = {"momba", "JohnBryan", "caesar_creek"};
+
+// Combined /api/dashboard endpoint: one round trip for weather, coffee and trails.
+// Servers without the route answer 404 and we fall back to the per-widget endpoints,
+// probing again every DASHBOARD_PROBE_INTERVAL in case the server was upgraded.
+#define RESULT_DASHBOARD (RESULT_WEATHER | RESULT_COFFEE | RESULT_TRAILS)
+const unsigned long DASHBOARD_PROBE_INTERVAL = 3600000; // Re-probe an unsupported server every hour
+bool dashboardSupported = true;      // Assume supported until the server says otherwise
+unsigned long dashboardProbeAt = 0;  // millis() of the last failed probe
+uint16_t dashboardSections = 0;      // Sections in the last full dashboard, still current on a 304
+
+// Worker-side trail copies; a 304 for one trail keeps its last known value
+TrailInfo workerTrails[3];
+
+// Sections the status server pushes over /api/events. While the stream is
+// healthy these are not polled; polling resumes as soon as it drops.
+#define RESULT_PUSHED (RESULT_WEATHER | RESULT_COFFEE | RESULT_TRAILS)
+
+// Queue a request for the worker without blocking the render loop
+bool queueFetchRequest(FetchRequestType type, const String &arg = "") {
+    if (fetchRequestQueue == NULL) {
+        return false;
+    }
+    FetchRequest request;
+    request.type = type;
+    strncpy(request.arg, arg.c_str(), sizeof(request.arg) - 1);
+    request.arg[sizeof(request.arg) - 1] = '\0';
+    if (xQueueSend(fetchRequestQueue, &request, 0) != pdTRUE) {
+        Serial.println("Fetch request queue full, dropping request");
+        return false;
     }
+    return true;
+}
 
-    // Button released (transition from LOW to HIGH)
-    if (currentRefreshState == HIGH && lastRefreshState == LOW) {
-        unsigned long holdDuration = currentTime - refreshHoldStart;
+// Breaker and backoff state belongs to the worker, so it prints the report between fetches
+void requestHealthReport() {
+    queueFetchRequest(REQUEST_PRINT_HEALTH);
+}
 
-        // If we were showing forecast, return to main screen
-        if (isShowingForecast) {
-            isShowingForecast = false;
-            Serial.println("Button released - returning to main screen");
-            redrawMainScreen();
+// Hand a finished result to loop(); drops it if loop() has fallen far behind
+void postFetchResult(FetchResult *result) {
+    if (result->fields == 0 && result->failed == 0) {
+        delete result;
+        return;
+    }
+    if (xQueueSend(fetchResultQueue, &result, pdMS_TO_TICKS(1000)) != pdTRUE) {
+        Serial.println("Fetch result queue full, dropping result");
+        delete result;
+        // The dropped data was already validated; force full bodies so loop() gets it again
+        httpPoolClearValidators();
+        return;
+    }
+    xTaskNotifyGive(loopTaskHandle);
+}
+
+// Fetch the combined dashboard document and fan it out into result.
+// Changed sections are added to result.fields. Returns every RESULT_* bit the
+// dashboard covered, changed or not; sections missing from the document are
+// left for the per-widget fetches.
+uint16_t fetchDashboard(FetchResult &result) {
+    if (!dashboardSupported) {
+        if (millis() - dashboardProbeAt < DASHBOARD_PROBE_INTERVAL) {
+            return 0;
         }
-        // Short press (not held long enough for forecast) - do normal refresh
-        else if (holdDuration < HOLD_THRESHOLD && holdDuration > 0) {
-            lastRefreshPress = currentTime;
-            Serial.println("Manual refresh triggered");
+        dashboardSupported = true;  // Probe again
+    }
 
-            // Force immediate refresh of all data
-            if (fetchTime() && fetchDate()) {
-                updateTimeDisplay();
+    PooledConnection *conn = httpPoolAcquire(serverHost, serverPort, "/api/dashboard");
+    if (conn == NULL) {
+        return 0;
+    }
+    int httpCode = httpPoolSend(conn, "GET");
+    uint16_t fields = 0;
+
+    if (httpCode == HTTP_CODE_OK) {
+        // Parse straight from the socket - one document holding every server-side
+        // widget; anything the server adds beyond what we display is skipped
+        static StaticJsonDocument<512> filter;
+        if (filter.isNull()) {
+            addWeatherFilter(filter["weather"].to<JsonObject>());
+            addCoffeeFilter(filter["coffee"].to<JsonObject>());
+            for (int i = 0; i < 3; i++) {
+                addTrailFilter(filter["trails"][trailIds[i]].to<JsonObject>());
             }
-            if (fetchStockPrice()) {
-                updateStockDisplay();
+        }
+        StaticJsonDocument<1024> doc;
+        DeserializationError error = httpParseJsonBody(conn->http, doc, filter);
+
+        if (!error) {
+            if (doc.containsKey("weather")) {
+                parseWeatherJson(doc["weather"], result.weather);
+                fields |= RESULT_WEATHER;
             }
-            if (fetchWeather()) {
-                updateWeatherDisplay();
+            if (doc.containsKey("coffee")) {
+                parseCoffeeJson(doc["coffee"], result.coffee);
+                fields |= RESULT_COFFEE;
             }
-            if (fetchCoffeeMachineStatus()) {
-                updateCoffeeMachineDisplay();
+            JsonObject trails = doc["trails"];
+            if (!trails.isNull() && trails.containsKey(trailIds[0]) &&
+                trails.containsKey(trailIds[1]) && trails.containsKey(trailIds[2])) {
+                for (int i = 0; i < 3; i++) {
+                    parseTrailJson(trails[trailIds[i]], result.trails[i]);
+                    workerTrails[i] = result.trails[i];
+                }
+                fields |= RESULT_TRAILS;
             }
+            Serial.println("Dashboard fetched, sections: " + String(fields, BIN));
+            result.fields |= fields;
+            dashboardSections = fields;
+            httpPoolCacheValidators(conn);
+        } else {
+            Serial.println("Failed to parse dashboard JSON: " + String(error.c_str()));
+        }
+    } else if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        // Nothing changed since the last full dashboard
+        fields = dashboardSections;
+    } else if (httpCode == HTTP_CODE_NOT_FOUND || httpCode == 405 || httpCode == 501) {
+        Serial.println("Server has no /api/dashboard, using per-widget endpoints");
+        dashboardSupported = false;
+        dashboardProbeAt = millis();
+    } else {
+        Serial.println("HTTP request for dashboard failed with code: " + String(httpCode));
+    }
+    httpPoolRelease(conn);
+    return fields;
+}
+
+// Poll every printer without a live WebSocket subscription, all in parallel with one
+// shared deadline, so an offline printer costs PRINTER_POLL_TIMEOUT once per poll
+// rather than once per printer. Returns the number of printers polled (worker task only)
+int pollPrinters() {
+    HttpMultiRequest requests[PRINTER_COUNT];
+    int indices[PRINTER_COUNT];
+    int count = 0;
+    for (int i = 0; i < PRINTER_COUNT && count < HTTP_MULTI_MAX_REQUESTS; i++) {
+        if (printerLinks[i].subscribed) {
+            continue;  // Already current
+        }
+        requests[count].host = workerPrinters[i].host;
+        requests[count].port = 80;
+        requests[count].path = "/printer/objects/query?webhooks&print_stats";
+        indices[count++] = i;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    unsigned long start = millis();
+    httpMultiGet(requests, count, PRINTER_POLL_TIMEOUT);
+    for (int k = 0; k < count; k++) {
+        applyPrinterResponse(workerPrinters[indices[k]], requests[k]);
+    }
+    Serial.println("Polled " + String(count) + " printers in " + String(millis() - start) + "ms");
+    return count;
+}
+
+// Hand the worker printer copies to a result; loop() owns the flash timer from here on
+void copyPrinters(FetchResult &result) {
+    for (int i = 0; i < PRINTER_COUNT; i++) {
+        result.printers[i] = workerPrinters[i];
+        workerPrinters[i].isFlashing = false;
+    }
+    result.fields |= RESULT_PRINTERS;
+}
+
+// One worker pass: the jobs run in it share a FetchResult and one dashboard fetch
+struct FetchPass {
+    FetchResult *result;
+    bool forced;                // Explicit request: fetch even sections that are pushed
+    bool dashboardTried;
+    uint16_t dashboardCovered;  // Sections the dashboard refreshed in this pass
+};
+
+void markFetched(uint16_t fields);
+
+// Sections fetched in the same pass share one /api/dashboard round trip.
+// Returns true if the dashboard covered section.
+bool fetchFromDashboard(FetchPass &pass, uint16_t section) {
+    if (!pass.dashboardTried) {
+        pass.dashboardTried = true;
+        pass.dashboardCovered = fetchDashboard(*pass.result);
+        // Every covered section is fresh now, due or not
+        markFetched(pass.dashboardCovered);
+    }
+    return (pass.dashboardCovered & section) != 0;
+}
+
+// Fetch jobs. Each fetches one data source into the pass's FetchResult and
+// returns false to be retried after FETCH_RETRY_DELAY.
+bool runStockJob(void *arg) {
+    FetchPass &pass = *(FetchPass *)arg;
+    bool ok = fetchStockPrice(pass.result->stock);
+    pass.result->fields |= ok ? RESULT_STOCK : 0;
+    pass.result->failed |= ok ? 0 : RESULT_STOCK;
+    return ok;
+}
+
+bool runWeatherJob(void *arg) {
+    FetchPass &pass = *(FetchPass *)arg;
+    if ((!pass.forced && serverEvents.healthy()) || fetchFromDashboard(pass, RESULT_WEATHER)) {
+        return true;
+    }
+    FetchStatus status = fetchWeather(pass.result->weather);
+    pass.result->fields |= status == FETCH_UPDATED ? RESULT_WEATHER : 0;
+    pass.result->failed |= status == FETCH_FAILED ? RESULT_WEATHER : 0;
+    return status != FETCH_FAILED;
+}
+
+bool runCoffeeJob(void *arg) {
+    FetchPass &pass = *(FetchPass *)arg;
+    if ((!pass.forced && serverEvents.healthy()) || fetchFromDashboard(pass, RESULT_COFFEE)) {
+        return true;
+    }
+    FetchStatus status = fetchCoffeeMachineStatus(pass.result->coffee);
+    pass.result->fields |= status == FETCH_UPDATED ? RESULT_COFFEE : 0;
+    pass.result->failed |= status == FETCH_FAILED ? RESULT_COFFEE : 0;
+    return status != FETCH_FAILED;
+}
+
+bool runTrailsJob(void *arg) {
+    FetchPass &pass = *(FetchPass *)arg;
+    if ((!pass.forced && serverEvents.healthy()) || fetchFromDashboard(pass, RESULT_TRAILS)) {
+        return true;
+    }
+    // A trail whose validator was cached must reach loop() once its body was parsed,
+    // so all three are fetched and any change is posted even if another trail failed
+    bool ok = true;
+    bool updated = false;
+    for (int i = 0; i < 3; i++) {
+        FetchStatus status = fetchTrailStatus(workerTrails[i], trailIds[i]);
+        ok = ok && status != FETCH_FAILED;
+        updated = updated || status == FETCH_UPDATED;
+    }
+    if (updated) {
+        for (int i = 0; i < 3; i++) {
+            pass.result->trails[i] = workerTrails[i];
+        }
+        pass.result->fields |= RESULT_TRAILS;
+    }
+    pass.result->failed |= ok ? 0 : RESULT_TRAILS;
+    return ok;
+}
+
+bool runPrintersJob(void *arg) {
+    FetchPass &pass = *(FetchPass *)arg;
+    // Printer polls update the worker copies; offline printers still count as fetched.
+    // Subscribed printers are skipped and report their changes as they happen.
+    if (pollPrinters() > 0) {
+        copyPrinters(*pass.result);
+    }
+    return true;
+}
+
+// Periodic data sources. A new source needs a job function and a row here.
+struct FetchJob {
+    const char *name;
+    uint16_t field;            // RESULT_* bit the job produces
+    SchedulerJobFunction run;
+    unsigned long interval;
+    unsigned long jitter;      // Up to this much is added to every interval
+    uint8_t priority;          // Higher runs first when several jobs are due
+    int id;                    // Scheduler job id, set by registerFetchJobs()
+};
+
+// When the dashboard is available the first of coffee, weather and trails to run
+// refreshes all three in one request, and the others find their data in the pass
+FetchJob fetchJobs[] = {
+    {"printers", RESULT_PRINTERS, runPrintersJob, PRINTER_UPDATE_INTERVAL, 2000,  3, -1},
+    {"coffee",   RESULT_COFFEE,   runCoffeeJob,   COFFEE_UPDATE_INTERVAL,  10000, 2, -1},
+    {"stock",    RESULT_STOCK,    runStockJob,    STOCK_UPDATE_INTERVAL,   10000, 1, -1},
+    {"weather",  RESULT_WEATHER,  runWeatherJob,  WEATHER_UPDATE_INTERVAL, 60000, 1, -1},
+    {"trails",   RESULT_TRAILS,   runTrailsJob,   TRAIL_UPDATE_INTERVAL,   60000, 1, -1},
+};
+const int FETCH_JOB_COUNT = sizeof(fetchJobs) / sizeof(fetchJobs[0]);
+const int FETCH_JOB_BUDGET = 3;  // Jobs per worker pass; requests and push channels are serviced in between
+
+// Register every fetch job with the scheduler, all due immediately
+void registerFetchJobs() {
+    for (int i = 0; i < FETCH_JOB_COUNT; i++) {
+        FetchJob &job = fetchJobs[i];
+        job.id = schedulerAddJob(job.name, job.run, job.interval, job.jitter, FETCH_RETRY_DELAY, job.priority);
+    }
+}
+
+int fetchJobId(uint16_t field) {
+    for (int i = 0; i < FETCH_JOB_COUNT; i++) {
+        if (fetchJobs[i].field == field) {
+            return fetchJobs[i].id;
+        }
+    }
+    return -1;
+}
+
+// Restart the interval of every job whose data arrived some other way
+void markFetched(uint16_t fields) {
+    unsigned long now = millis();
+    for (int i = 0; i < FETCH_JOB_COUNT; i++) {
+        if (fields & fetchJobs[i].field) {
+            schedulerComplete(fetchJobs[i].id, true, now);
+        }
+    }
+}
+
+// Run the fetches selected by mask now, due or not, and post one combined result (worker task only)
+void runFetches(uint16_t mask) {
+    FetchResult *result = new FetchResult();
+    FetchPass pass = {result, true, false, 0};
+
+    for (int i = 0; i < FETCH_JOB_COUNT; i++) {
+        FetchJob &job = fetchJobs[i];
+        if ((mask & job.field) && !(pass.dashboardCovered & job.field)) {
+            bool ok = job.run(&pass);
+            schedulerComplete(job.id, ok, millis());
+        }
+    }
+    if (mask & RESULT_FORECAST) {
+        bool ok = fetchForecast(result->forecast);
+        result->fields |= ok ? RESULT_FORECAST : 0;
+        result->failed |= ok ? 0 : RESULT_FORECAST;
+    }
+
+    postFetchResult(result);
+}
+
+// Run the jobs that are due, at most FETCH_JOB_BUDGET of them, and post one combined result (worker task only)
+void runDueFetches() {
+    if (schedulerTimeUntilNext(millis()) > 0) {
+        return;
+    }
+    FetchResult *result = new FetchResult();
+    FetchPass pass = {result, false, false, 0};
+    schedulerRunDue(millis(), FETCH_JOB_BUDGET, &pass);
+    postFetchResult(result);
+}
+
+// Turn a pushed change event into a FetchResult for loop() (worker task only).
+// Event data has the same shape as the matching section of /api/dashboard.
+void handleServerEvent(const String &event, const String &data) {
+    StaticJsonDocument<1024> doc;
+    DeserializationError error = deserializeJson(doc, data);
+    if (error) {
+        Serial.println("Failed to parse " + event + " event: " + String(error.c_str()));
+        return;
+    }
+
+    FetchResult *result = new FetchResult();
+    if (event == "weather") {
+        parseWeatherJson(doc, result->weather);
+        result->fields = RESULT_WEATHER;
+    } else if (event == "coffee") {
+        parseCoffeeJson(doc, result->coffee);
+        result->fields = RESULT_COFFEE;
+    } else if (event == "trails") {
+        // Keyed by trail id; trails missing from the event keep their last value
+        for (int i = 0; i < 3; i++) {
+            if (doc.containsKey(trailIds[i])) {
+                parseTrailJson(doc[trailIds[i]], workerTrails[i]);
+            }
+            result->trails[i] = workerTrails[i];
+        }
+        result->fields = RESULT_TRAILS;
+    } else {
+        Serial.println("Ignoring unknown event: " + event);
+    }
+    if (result->fields != 0) {
+        Serial.println("Pushed " + event + " update");
+    }
+    postFetchResult(result);
+}
+
+// Ask Moonraker to push print_stats.state and webhooks.state changes
+void subscribePrinter(int index) {
+    printerLinks[index].socket.sendText(
+        "{\"jsonrpc\":\"2.0\",\"method\":\"printer.objects.subscribe\","
+        "\"params\":{\"objects\":{\"print_stats\":[\"state\"],\"webhooks\":[\"state\"]}},"
+        "\"id\":" + String(PRINTER_SUBSCRIBE_ID) + "}");
+}
+
+// Moonraker JSON-RPC message from printer (int)context (worker task only)
+void handlePrinterMessage(void *context, const String &message) {
+    int index = (int)(intptr_t)context;
+    PrinterLink &link = printerLinks[index];
+    PrinterInfo &printer = workerPrinters[index];
+
+    // Keep only what we act on; proc stats and other notifications shrink to {"method": ...}
+    static StaticJsonDocument<256> filter;
+    if (filter.isNull()) {
+        filter["method"] = true;
+        filter["id"] = true;
+        filter["error"] = true;
+        filter["result"]["status"]["print_stats"]["state"] = true;
+        filter["result"]["status"]["webhooks"]["state"] = true;
+        filter["params"][0]["print_stats"]["state"] = true;
+        filter["params"][0]["webhooks"]["state"] = true;
+    }
+    StaticJsonDocument<256> doc;
+    if (deserializeJson(doc, message, DeserializationOption::Filter(filter))) {
+        return;
+    }
+
+    String method = doc["method"] | "";
+    JsonVariantConst status;
+    if (doc["id"] == PRINTER_SUBSCRIBE_ID) {
+        if (doc.containsKey("error")) {
+            Serial.println("Printer " + printer.name + " subscribe failed, polling until Klippy is ready");
+            return;
+        }
+        status = doc["result"]["status"];
+        link.subscribed = true;
+        Serial.println("Printer " + printer.name + " subscribed over WebSocket");
+    } else if (method == "notify_status_update") {
+        status = doc["params"][0];
+    } else if (method == "notify_klippy_ready") {
+        subscribePrinter(index);  // Klippy restarted; its subscriptions are gone
+        return;
+    } else if (method == "notify_klippy_shutdown" || method == "notify_klippy_disconnected") {
+        link.subscribed = false;
+        link.printState = "";
+        link.webhooksState = "";
+        printer.status = method == "notify_klippy_shutdown" ? "error" : "offline";
+        printer.lastStatus = printer.status;
+        FetchResult *result = new FetchResult();
+        copyPrinters(*result);
+        postFetchResult(result);
+        return;
+    } else {
+        return;
+    }
+
+    if (status["print_stats"]["state"].is<const char *>()) {
+        link.printState = status["print_stats"]["state"].as<String>();
+    }
+    if (status["webhooks"]["state"].is<const char *>()) {
+        link.webhooksState = status["webhooks"]["state"].as<String>();
+    }
+    String previousStatus = printer.status;
+    if (applyPrinterState(printer, link.printState, link.webhooksState) &&
+        (printer.status != previousStatus || printer.isFlashing)) {
+        FetchResult *result = new FetchResult();
+        copyPrinters(*result);
+        postFetchResult(result);
+    }
+}
+
+void printPrinterLinkStats() {
+    for (int i = 0; i < PRINTER_COUNT; i++) {
+        printerLinks[i].socket.printStats(workerPrinters[i].name + (printerLinks[i].subscribed ? " (subscribed)" : ""));
+    }
+}
+
+// Service the printer WebSockets (worker task only)
+void pollPrinterLinks() {
+    for (int i = 0; i < PRINTER_COUNT; i++) {
+        PrinterLink &link = printerLinks[i];
+        link.socket.poll();
+        if (link.socket.takeConnected()) {
+            subscribePrinter(i);
+        }
+        if (!link.socket.connected() && link.subscribed) {
+            // Printer powered off or rebooted; the next poll reports it
+            link.subscribed = false;
+            schedulerExpedite(fetchJobId(RESULT_PRINTERS), millis());
+        }
+    }
+}
+
+void handleFetchRequest(const FetchRequest &request) {
+    switch (request.type) {
+        case REQUEST_REFRESH_ALL:
+            // A manual refresh probes hosts whose circuit is open instead of waiting
+            breakerProbeNow();
             // Force server to refresh trail data from sources, then fetch updated cache
             refreshAllTrails();
-            if (fetchTrailStatus(mombaTrail, "momba") &&
-                fetchTrailStatus(johnBryanTrail, "JohnBryan") &&
-                fetchTrailStatus(caesarCreekTrail, "caesar_creek")) {
-                updateTrailDisplay();
+            runFetches(RESULT_PERIODIC);
+            break;
+        case REQUEST_FORECAST:
+            runFetches(RESULT_FORECAST);
+            break;
+        case REQUEST_COFFEE_ON:
+        case REQUEST_COFFEE_OFF:
+            if (sendCoffeeCommand(request.type == REQUEST_COFFEE_ON, String(request.arg))) {
+                runFetches(RESULT_COFFEE);  // Update display immediately
+            }
+            break;
+        case REQUEST_COFFEE_SCHEDULE:
+            if (setCoffeeSchedule(String(request.arg))) {
+                Serial.println("Coffee auto-schedule successful");
+            } else {
+                Serial.println("Coffee auto-schedule failed");
             }
-            if (WiFi.status() == WL_CONNECTED) {
-                fetchPrinterStatus(sovolPrinter);
-                fetchPrinterStatus(mandrainPrinter);
+            break;
+        case REQUEST_PRINT_HEALTH:
+            breakerPrintStats();
+            schedulerPrintStats();
+            break;
+    }
+}
+
+void fetchWorkerTask(void *param) {
+    bool online = false;
+    for (;;) {
+        // Sleep until a request arrives or the next job is due, waking at least
+        // every FETCH_WORKER_IDLE_MS to service the push channels
+        unsigned long wait = FETCH_WORKER_IDLE_MS;
+        if (wifiLinkUp()) {
+            unsigned long untilDue = schedulerTimeUntilNext(millis());
+            wait = untilDue < wait ? untilDue : wait;
+        }
+        FetchRequest request;
+        if (xQueueReceive(fetchRequestQueue, &request, pdMS_TO_TICKS(wait)) == pdTRUE) {
+            if (wifiLinkUp() || request.type == REQUEST_PRINT_HEALTH) {
+                handleFetchRequest(request);
+            } else if (request.type == REQUEST_FORECAST) {
+                // No network: let loop() fall back to current weather
+                FetchResult *result = new FetchResult();
+                result->failed = RESULT_FORECAST;
+                postFetchResult(result);
             }
-            updatePrinterDisplay();
-            drawWeatherIconStatic();  // Draw static weather icon after refresh
+            continue;  // Drain pending requests before periodic work
         }
 
-        refreshHoldStart = 0;  // Reset hold tracking
+        // Jobs stay due while the link is down and run once it is back
+        if (!wifiLinkUp()) {
+            online = false;
+            continue;
+        }
+        if (!online) {
+            online = true;
+            breakerProbeNow();  // Hosts that failed only because the link dropped
+        }
+        httpPoolEvictIdle();
+        dnsCacheRefresh();
+
+        // Pushed changes arrive here within one idle period
+        serverEvents.poll();
+        pollPrinterLinks();
+        if (serverEvents.takeReconnected()) {
+            runFetches(RESULT_PUSHED);  // Resync whatever changed while the stream was down
+            continue;
+        }
+
+        runDueFetches();
     }
+}
 
-    lastRefreshState = currentRefreshState;
+void startFetchWorker() {
+    fetchRequestQueue = xQueueCreate(FETCH_REQUEST_QUEUE_LENGTH, sizeof(FetchRequest));
+    fetchResultQueue = xQueueCreate(FETCH_RESULT_QUEUE_LENGTH, sizeof(FetchResult *));
+    registerFetchJobs();
+    for (int i = 0; i < PRINTER_COUNT; i++) {
+        workerPrinters[i] = printers[i];
+        // Moonraker's /websocket, proxied on port 80 like the HTTP API
+        printerLinks[i].socket.begin(workerPrinters[i].host, 80, "/websocket", handlePrinterMessage, (void *)(intptr_t)i);
+    }
+    xTaskCreatePinnedToCore(fetchWorkerTask, "fetchWorker", FETCH_WORKER_STACK_SIZE, NULL, 1,
+                            &fetchWorkerHandle, FETCH_WORKER_CORE);
+    Serial.println("Fetch worker started on core " + String(FETCH_WORKER_CORE));
 }
 
+// Copy printer state from the worker; the flash animation timer is owned here
+void applyPrinterResult(PrinterInfo &printer, const PrinterInfo &fetched) {
+    printer.status = fetched.status;
+    printer.lastStatus = fetched.lastStatus;
+    if (fetched.isFlashing) {
+        printer.isFlashing = true;
+        printer.flashStartTime = millis();
+    }
+}
 
+// ============================================================================
+// WARM BOOT SNAPSHOT - last-known widget state kept in NVS (loop() only)
+// ============================================================================
+// Sections use the RESULT_* bits. Only sections holding real data are saved,
+// each with its fields in a fixed order; bump SNAPSHOT_VERSION when it changes.
+uint16_t knownSections = 0;  // Sections holding fetched (or restored) data
+uint16_t staleSections = 0;  // Restored at boot and not refreshed yet
+bool snapshotDirty = false;  // Widget state changed since the last save
+
+void writeForecastDay(SnapshotWriter &out, const ForecastDay &day) {
+    out.writeString(day.date);
+    out.writeInt16(day.high);
+    out.writeInt16(day.low);
+    out.writeString(day.conditions);
+    out.writeByte(day.icon);
+}
 
-void setup() {
-    Serial.begin(115200);
-    delay(1000); // Give time for serial to initialize
-    
-    Serial.println("ESP32 Status Screen Starting...");
-    Serial.println("Initializing TFT display...");
-    
-    tft.init();
-    tft.setRotation(0);
-    tft.fillScreen(BACKGROUND);
-    tft.setTextColor(TEXT_COLOR, BACKGROUND);
+void readForecastDay(SnapshotReader &in, ForecastDay &day) {
+    day.date = in.readString();
+    day.high = in.readInt16();
+    day.low = in.readInt16();
+    day.conditions = in.readString();
+    day.icon = (IconId)in.readByte();
+}
+
+void saveSnapshot() {
+    SnapshotWriter out;
+    out.writeInt16(knownSections);
+    if (knownSections & RESULT_WEATHER) {
+        out.writeString(currentWeather.conditions);
+        out.writeInt16(currentWeather.temperature);
+        out.writeInt16(currentWeather.feels_like);
+        out.writeInt16(currentWeather.humidity);
+        out.writeByte(currentWeather.icon);
+    }
+    if (knownSections & RESULT_FORECAST) {
+        writeForecastDay(out, weatherForecast.today);
+        writeForecastDay(out, weatherForecast.tomorrow);
+    }
+    if (knownSections & RESULT_COFFEE) {
+        out.writeString(coffeeMachine.status);
+        out.writeString(coffeeMachine.scheduledTime);
+        out.writeString(coffeeMachine.esp32Status);
+    }
+    if (knownSections & RESULT_TRAILS) {
+        TrailInfo *trails[3] = {&mombaTrail, &johnBryanTrail, &caesarCreekTrail};
+        for (int i = 0; i < 3; i++) {
+            out.writeString(trails[i]->status);
+            out.writeString(trails[i]->lastUpdate);
+        }
+    }
+    if (knownSections & RESULT_STOCK) {
+        out.writeString(spyStock.symbol);
+        out.writeFloat(spyStock.price);
+        out.writeFloat(spyStock.change);
+        out.writeFloat(spyStock.changePercent);
+    }
+    if (knownSections & RESULT_PRINTERS) {
+        out.writeByte(PRINTER_COUNT);
+        for (int i = 0; i < PRINTER_COUNT; i++) {
+            out.writeString(printers[i].status);
+        }
+    }
+    snapshotSave(out);
+}
+
+// Load the snapshot into the widget structs. Everything is decoded into copies
+// first, so a truncated or mismatched snapshot changes nothing. Returns true if
+// anything was restored.
+bool restoreSnapshot() {
+    static uint8_t buffer[SNAPSHOT_MAX_SIZE];
+    size_t length = snapshotLoad(buffer, sizeof(buffer));
+    if (length == 0) {
+        return false;
+    }
+
+    SnapshotReader in(buffer, length);
+    uint16_t sections = in.readInt16() & (RESULT_PERIODIC | RESULT_FORECAST);
+    WeatherInfo weather = currentWeather;
+    ForecastInfo forecast = weatherForecast;
+    CoffeeMachineInfo coffee = coffeeMachine;
+    TrailInfo trails[3] = {mombaTrail, johnBryanTrail, caesarCreekTrail};
+    StockInfo stock = spyStock;
+    String printerStatus[PRINTER_COUNT];
+
+    if (sections & RESULT_WEATHER) {
+        weather.conditions = in.readString();
+        weather.temperature = in.readInt16();
+        weather.feels_like = in.readInt16();
+        weather.humidity = in.readInt16();
+        weather.icon = (IconId)in.readByte();
+    }
+    if (sections & RESULT_FORECAST) {
+        readForecastDay(in, forecast.today);
+        readForecastDay(in, forecast.tomorrow);
+        forecast.valid = true;
+    }
+    if (sections & RESULT_COFFEE) {
+        coffee.status = in.readString();
+        coffee.scheduledTime = in.readString();
+        coffee.esp32Status = in.readString();
+    }
+    if (sections & RESULT_TRAILS) {
+        for (int i = 0; i < 3; i++) {
+            trails[i].status = in.readString();
+            trails[i].lastUpdate = in.readString();
+        }
+    }
+    if (sections & RESULT_STOCK) {
+        stock.symbol = in.readString();
+        stock.price = in.readFloat();
+        stock.change = in.readFloat();
+        stock.changePercent = in.readFloat();
+    }
+    if (sections & RESULT_PRINTERS) {
+        if (in.readByte() != PRINTER_COUNT) {
+            return false;  // printerConfig changed since the snapshot was taken
+        }
+        for (int i = 0; i < PRINTER_COUNT; i++) {
+            printerStatus[i] = in.readString();
+        }
+    }
+    if (!in.ok()) {
+        Serial.println("Snapshot truncated, ignoring it");
+        return false;
+    }
+
+    currentWeather = weather;
+    weatherForecast = forecast;
+    coffeeMachine = coffee;
+    if (coffeeMachine.status == "On" && coffeeMachine.scheduledTime.length() > 0) {
+        lastCoffeeScheduledTime = coffeeMachine.scheduledTime;
+    }
+    mombaTrail = trails[0];
+    johnBryanTrail = trails[1];
+    caesarCreekTrail = trails[2];
+    spyStock = stock;
+    if (sections & RESULT_PRINTERS) {
+        for (int i = 0; i < PRINTER_COUNT; i++) {
+            printers[i].status = printerStatus[i];
+            printers[i].lastStatus = printerStatus[i];
+        }
+    }
+
+    knownSections = sections;
+    staleSections = sections & RESULT_PERIODIC;  // The forecast is fetched on demand anyway
+    Serial.println("Restored snapshot (" + String(length) + " bytes), sections: " + String(sections, BIN));
+    return sections != 0;
+}
+
+// Dot in the top left corner while any widget still shows restored data
+void drawStaleMarker() {
+    TFT_eSprite &out = beginWidget(WIDGET_STALE_MARKER);
+    if (staleSections != 0) {
+        out.fillCircle(3, 3, 3, TFT_ORANGE);
+    }
+    pushWidget();
+}
+
+// Record freshly fetched sections: they are worth saving and no longer stale
+void noteFetchedSections(uint16_t fields) {
+    fields &= RESULT_PERIODIC | RESULT_FORECAST;
+    if (fields == 0) {
+        return;
+    }
+    knownSections |= fields;
+    snapshotDirty = true;
+    if ((staleSections & fields) != 0) {
+        staleSections &= ~fields;
+        if (staleSections == 0) {
+            regionInvalidate(WIDGET_STALE_MARKER);  // Everything is live again
+        }
+    }
+}
+
+// ============================================================================
+// BOOT SEQUENCE - stages overlap; loop() is live from the first frame
+// ============================================================================
+// setup() only initializes the display, draws the first frame and starts
+// Wi-Fi and the fetch worker. advanceBoot() moves the remaining stages along
+// from loop() without blocking, and every stage is timestamped so startup
+// regressions show up in the "boot" serial command.
+enum BootStage : uint8_t {
+    BOOT_DISPLAY,         // tft.init() done
+    BOOT_FIRST_FRAME,     // Snapshot or empty widgets on screen
+    BOOT_WIFI_START,      // Association started
+    BOOT_WIFI_CONNECTED,  // Got an IP address
+    BOOT_NTP_SYNCED,      // Clock set from SNTP
+    BOOT_FIRST_DATA,      // First fetched result applied
+    BOOT_STAGE_COUNT
+};
+const char *bootStageNames[BOOT_STAGE_COUNT] = {
+    "display", "first frame", "wifi start", "wifi connected", "ntp synced", "first data"
+};
+const unsigned long BOOT_WIFI_TIMEOUT = 15000;  // Then show demo data (cold boot) and scan for diagnostics
+
+unsigned long bootTimeline[BOOT_STAGE_COUNT];  // millis() when each stage finished, 0 = not yet
+bool bootComplete = false;
+bool bootWifiGaveUp = false;
+bool bootNtpStarted = false;
+
+void printBootTimeline() {
+    unsigned long previous = 0;
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+        if (bootTimeline[i] == 0) {
+            Serial.println("  " + String(bootStageNames[i]) + ": pending");
+            continue;
+        }
+        Serial.println("  " + String(bootStageNames[i]) + ": " + String(bootTimeline[i]) + "ms (+" +
+                       String(bootTimeline[i] - previous) + ")");
+        previous = bootTimeline[i];
+    }
+}
+
+void markBootStage(BootStage stage) {
+    if (bootTimeline[stage] != 0) {
+        return;
+    }
+    unsigned long now = millis();
+    bootTimeline[stage] = now > 0 ? now : 1;
+    Serial.println("[boot] " + String(bootStageNames[stage]) + " at " + String(bootTimeline[stage]) + "ms");
+
+    bool done = true;
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+        done = done && bootTimeline[i] != 0;
+    }
+    if (done) {
+        bootComplete = true;
+        Serial.println("Boot timeline:");
+        printBootTimeline();
+    }
+}
+
+// Placeholder data so the layout can be checked without a network (cold boot only)
+void setDemoData() {
+    currentTime.time = "12:34";
+    currentTime.seconds = "56";
+    currentTime.date = "Demo Mode Active";
+    spyStock.symbol = "SPY";
+    spyStock.price = 450.25;
+    spyStock.change = 2.15;
+    spyStock.changePercent = 0.48;
+    currentWeather.conditions = "Demo Weather";
+    currentWeather.temperature = 72;
+    currentWeather.humidity = 50;
+    currentWeather.icon = ICON_CLEAR_DAY;
+    coffeeMachine.status = "Demo";
+    coffeeMachine.esp32Status = "online";
+    mombaTrail.status = "open";
+    mombaTrail.lastUpdate = "Demo";
+    johnBryanTrail.status = "closed";
+    johnBryanTrail.lastUpdate = "Demo";
+    caesarCreekTrail.status = "wet";
+    caesarCreekTrail.lastUpdate = "Demo";
+    Serial.println("Running in demo mode - no WiFi required");
+}
+
+// Print the networks found by the background scan started when Wi-Fi gave up
+void reportWifiScan() {
+    int n = WiFi.scanComplete();
+    if (n == WIFI_SCAN_RUNNING || n == WIFI_SCAN_FAILED) {
+        return;
+    }
+    if (n == 0) {
+        Serial.println("No networks found");
+    } else {
+        Serial.println(String(n) + " networks found:");
+        for (int i = 0; i < n; ++i) {
+            Serial.println(String(i + 1) + ": " + WiFi.SSID(i) + " (" + String(WiFi.RSSI(i)) + ")" +
+                           ((WiFi.encryptionType(i) == WIFI_AUTH_OPEN) ? " " : "*"));
+        }
+    }
+    WiFi.scanDelete();
+}
+
+// Move the boot stages along; called every loop() iteration until boot completes
+void advanceBoot() {
+    if (bootComplete) {
+        return;
+    }
+    unsigned long now = millis();
+
+    if (bootTimeline[BOOT_WIFI_CONNECTED] == 0) {
+        if (wifiLinkUp()) {
+            markBootStage(BOOT_WIFI_CONNECTED);
+        } else if (!bootWifiGaveUp && now - bootTimeline[BOOT_WIFI_START] >= BOOT_WIFI_TIMEOUT) {
+            // Association keeps going in the background; this only changes what is shown
+            bootWifiGaveUp = true;
+            Serial.println("WiFi not connected after " + String(BOOT_WIFI_TIMEOUT / 1000) + "s, status: " +
+                           String(WiFi.status()));
+            if (knownSections == 0) {
+                setDemoData();
+                if (!isShowingForecast) {
+                    redrawMainScreen();
+                }
+            }
+            Serial.println("Scanning for available networks...");
+            WiFi.scanNetworks(true);  // Async; reported by reportWifiScan()
+        }
+    }
+    if (bootWifiGaveUp) {
+        reportWifiScan();
+    }
+
+    if (bootTimeline[BOOT_WIFI_CONNECTED] != 0 && !bootNtpStarted) {
+        setupNTP();
+        bootNtpStarted = true;
+    }
+    if (bootNtpStarted && bootTimeline[BOOT_NTP_SYNCED] == 0 && timeSyncValid()) {
+        markBootStage(BOOT_NTP_SYNCED);
+        secondTickBegin(loopTaskHandle);
+        CivilTime now = civilTimeFromUtc(time(NULL));
+        Serial.println("Clock set: " + civilFormatDate(now) + " " + String(now.year) + ", " + civilZoneName(now) +
+                       " (UTC" + (now.utcOffset < 0 ? "-" : "+") + String(labs(now.utcOffset) / 3600) + ")");
+    }
+}
+
+// Field-by-field comparisons so unchanged data does not cause a repaint
+bool sameWeather(const WeatherInfo &a, const WeatherInfo &b) {
+    return a.conditions == b.conditions && a.temperature == b.temperature &&
+           a.feels_like == b.feels_like && a.humidity == b.humidity && a.icon == b.icon;
+}
+
+bool sameCoffee(const CoffeeMachineInfo &a, const CoffeeMachineInfo &b) {
+    return a.status == b.status && a.scheduledTime == b.scheduledTime && a.esp32Status == b.esp32Status;
+}
+
+bool sameTrail(const TrailInfo &a, const TrailInfo &b) {
+    return a.status == b.status && a.lastUpdate == b.lastUpdate;
+}
+
+// Apply a worker result to the widget state and redraw what changed (loop() only)
+void applyFetchResult(FetchResult *result) {
+    bool drawWidgets = !isShowingForecast;
+    noteFetchedSections(result->fields);
+    if (result->fields != 0) {
+        markBootStage(BOOT_FIRST_DATA);
+    }
+
+    if (result->fields & RESULT_STOCK) {
+        spyStock = result->stock;
+        if (drawWidgets) {
+            markTextChanges(WIDGET_STOCK);
+        }
+    }
+    // Dashboard fetches refresh sections that were not due, so only repaint what changed
+    if (result->fields & RESULT_WEATHER) {
+        bool changed = !sameWeather(currentWeather, result->weather);
+        bool iconChanged = currentWeather.icon != result->weather.icon;
+        currentWeather = result->weather;
+        if (drawWidgets && changed) {
+            markTextChanges(WIDGET_WEATHER_TEXT);
+            if (iconChanged) regionInvalidate(WIDGET_WEATHER_ICON);
+        }
+    }
+    if (result->fields & RESULT_COFFEE) {
+        bool changed = !sameCoffee(coffeeMachine, result->coffee);
+        coffeeMachine = result->coffee;
+        // Track the scheduled time when coffee is on, for auto-schedule feature
+        if (coffeeMachine.status == "On" && coffeeMachine.scheduledTime.length() > 0) {
+            lastCoffeeScheduledTime = coffeeMachine.scheduledTime;
+        }
+        if (drawWidgets && changed) markTextChanges(WIDGET_COFFEE);
+    }
+    if (result->fields & RESULT_TRAILS) {
+        bool changed = !sameTrail(mombaTrail, result->trails[0]) ||
+                       !sameTrail(johnBryanTrail, result->trails[1]) ||
+                       !sameTrail(caesarCreekTrail, result->trails[2]);
+        mombaTrail = result->trails[0];
+        johnBryanTrail = result->trails[1];
+        caesarCreekTrail = result->trails[2];
+        if (drawWidgets && changed) markTextChanges(WIDGET_TRAILS);
+    }
+    if (result->fields & RESULT_PRINTERS) {
+        for (int i = 0; i < PRINTER_COUNT; i++) {
+            applyPrinterResult(printers[i], result->printers[i]);
+        }
+        if (drawWidgets) regionInvalidate(WIDGET_PRINTERS);
+    }
+    if (result->fields & RESULT_FORECAST) {
+        weatherForecast = result->forecast;
+    } else if (result->failed & RESULT_FORECAST) {
+        setForecastFallback();
+    }
+    if ((result->fields | result->failed) & RESULT_FORECAST) {
+        if (isShowingForecast) drawForecastView();
+    }
+
+    if (result->failed & RESULT_PERIODIC) {
+        Serial.println("Data fetch failed:" +
+                       String(result->failed & RESULT_STOCK ? " stock" : "") +
+                       String(result->failed & RESULT_WEATHER ? " weather" : "") +
+                       String(result->failed & RESULT_COFFEE ? " coffee" : "") +
+                       String(result->failed & RESULT_TRAILS ? " trails" : ""));
+    }
+}
+
+// ms left until last + interval, 0 when already due
+unsigned long timeUntil(unsigned long last, unsigned long interval, unsigned long now) {
+    unsigned long elapsed = now - last;
+    return elapsed >= interval ? 0 : interval - elapsed;
+}
+
+// Block loop() for up to ms, returning early when the worker posts a result or
+// a seconds tick fires (both notify this task; one arriving mid-loop is kept)
+void waitForWork(unsigned long ms) {
+    if (ms == 0) {
+        ms = 1;  // Yield anyway, so a deadline that keeps failing cannot spin the core
+    }
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+}
+
+// Apply every result the worker has posted since the last loop iteration
+void processFetchResults() {
+    FetchResult *result;
+    while (xQueueReceive(fetchResultQueue, &result, 0) == pdTRUE) {
+        applyFetchResult(result);
+        delete result;
+    }
+}
+
+// Function to toggle coffee machine on/off
+void toggleCoffeeMachine() {
+    // If coffee is currently on, turn it off
+    if (coffeeMachine.status == "On") {
+        queueFetchRequest(REQUEST_COFFEE_OFF);
+    } else {
+        // If off, turn it on with the last scheduled time (or activate immediately if no time)
+        queueFetchRequest(REQUEST_COFFEE_ON, lastCoffeeScheduledTime);
+    }
+}
+
+// Add this function before setup()
+void handleRotation() {
+    static bool lastButtonState = HIGH;
+    unsigned long currentTime = millis();
     
-    Serial.println("TFT initialized successfully");
+    bool currentButtonState = digitalRead(BUTTON_PIN);
     
-    // Test display with a simple pattern
-    tft.fillScreen(TFT_RED);
-    delay(500);
-    tft.fillScreen(TFT_GREEN);
-    delay(500);
-    tft.fillScreen(TFT_BLUE);
-    delay(500);
-    tft.fillScreen(BACKGROUND);
-    tft.setTextSize(2);
-    tft.setTextColor(TFT_WHITE);
-    tft.drawString("ESP32 Ready", 50, 100);
-    Serial.println("Display test pattern completed");
+    if (currentButtonState == LOW && lastButtonState == HIGH) {
+        if (currentTime - lastButtonPress >= DEBOUNCE_DELAY) {
+            lastButtonPress = currentTime;
+            currentRotation = (currentRotation + 1) % 4;
+            tft.setRotation(currentRotation);
+            
+            // Force complete refresh of display with the new rotation's layout
+            if (!isShowingForecast) {
+                redrawMainScreen();
+            }
+        }
+    }
     
-    Serial.println("Connecting to WiFi...");
-    Serial.print("SSID: ");
-    Serial.println(ssid);
-    Serial.print("Password length: ");
-    Serial.println(strlen(password));
+    lastButtonState = currentButtonState;
+}
+
+void handleScreenToggle() {
+    static bool lastToggleState = HIGH;
+    static unsigned long lastPressTime = 0;
+    static bool waitingForDoublePress = false;
+    const unsigned long DOUBLE_PRESS_WINDOW = 400;  // 400ms window for double press
     
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, password);
+    unsigned long currentTime = millis();
+    bool currentToggleState = digitalRead(SCREEN_TOGGLE_PIN);
     
-    int wifiAttempts = 0;
-    while (WiFi.status() != WL_CONNECTED && wifiAttempts < 30) {
-        delay(500);
-        wifiAttempts++;
-        Serial.print(".");
-        
-        // Print WiFi status for debugging
-        if (wifiAttempts % 10 == 0) {
-            Serial.println();
-            Serial.print("WiFi Status: ");
-            switch (WiFi.status()) {
-                case WL_NO_SSID_AVAIL:
-                    Serial.println("No SSID Available");
-                    break;
-                case WL_CONNECT_FAILED:
-                    Serial.println("Connection Failed");
-                    break;
-                case WL_CONNECTION_LOST:
-                    Serial.println("Connection Lost");
-                    break;
-                case WL_DISCONNECTED:
-                    Serial.println("Disconnected");
-                    break;
-                default:
-                    Serial.println("Other");
-                    break;
+    // Detect button press (LOW = pressed)
+    if (currentToggleState == LOW && lastToggleState == HIGH) {
+        if (currentTime - lastScreenToggle >= DEBOUNCE_DELAY) {
+            lastScreenToggle = currentTime;
+            
+            // Check if this is within the double-press window
+            if (waitingForDoublePress && (currentTime - lastPressTime) < DOUBLE_PRESS_WINDOW) {
+                // Double press detected - Toggle coffee machine
+                waitingForDoublePress = false;
+                Serial.println("Double press detected - Toggling coffee machine");
+                toggleCoffeeMachine();
+            } else {
+                // First press - start waiting for potential double press
+                waitingForDoublePress = true;
+                lastPressTime = currentTime;
             }
         }
     }
     
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("\nWiFi connected successfully!");
-        Serial.print("IP address: ");
-        Serial.println(WiFi.localIP());
-        Serial.print("Signal strength (RSSI): ");
-        Serial.print(WiFi.RSSI());
-        Serial.println(" dBm");
-    } else {
-        Serial.println("\nWiFi connection failed!");
-        Serial.print("Final WiFi Status: ");
-        Serial.println(WiFi.status());
+    // Check if double-press window expired (single press confirmed)
+    if (waitingForDoublePress && (currentTime - lastPressTime) >= DOUBLE_PRESS_WINDOW) {
+        waitingForDoublePress = false;
+        
+        // Single press - Toggle screen ON/OFF
+        isScreenOn = !isScreenOn;
         
-        // Try to scan for available networks
-        Serial.println("Scanning for available networks...");
-        int n = WiFi.scanNetworks();
-        if (n == 0) {
-            Serial.println("No networks found");
+        if (isScreenOn) {
+            // Turn screen ON
+            digitalWrite(TFT_BL, HIGH);  // Turn on backlight
+            
+            // Refresh everything
+            if (!isShowingForecast) {
+                redrawMainScreen();
+            }
+            
+            Serial.println("Single press - Screen ON");
         } else {
-            Serial.print(n);
-            Serial.println(" networks found:");
-            for (int i = 0; i < n; ++i) {
-                Serial.print(i + 1);
-                Serial.print(": ");
-                Serial.print(WiFi.SSID(i));
-                Serial.print(" (");
-                Serial.print(WiFi.RSSI(i));
-                Serial.print(")");
-                Serial.println((WiFi.encryptionType(i) == WIFI_AUTH_OPEN) ? " " : "*");
-                delay(10);
+            // Turn screen OFF
+            digitalWrite(TFT_BL, LOW);   // Turn off backlight
+            
+            // AUTO-SCHEDULE FEATURE: When screen turns off, set coffee to last scheduled time
+            if (lastCoffeeScheduledTime.length() > 0) {
+                Serial.println("Auto-scheduling coffee to: " + lastCoffeeScheduledTime);
+                queueFetchRequest(REQUEST_COFFEE_SCHEDULE, lastCoffeeScheduledTime);
+            } else {
+                Serial.println("No previous coffee schedule time available for auto-schedule");
             }
+            
+            Serial.println("Single press - Screen OFF");
         }
     }
     
-    // Continue with display setup even if WiFi fails
-    Serial.println("Setting up display and buttons...");
+    lastToggleState = currentToggleState;
+}
+
+void handleRefresh() {
+    static bool lastRefreshState = HIGH;
+    unsigned long currentTime = millis();
+    bool currentRefreshState = digitalRead(REFRESH_PIN);
+
+    // Button just pressed (transition from HIGH to LOW)
+    if (currentRefreshState == LOW && lastRefreshState == HIGH) {
+        if (currentTime - lastRefreshPress >= DEBOUNCE_DELAY) {
+            refreshHoldStart = currentTime;  // Start tracking hold time
+            Serial.println("Refresh button pressed - hold for forecast view");
+        }
+    }
+
+    // Button is being held down
+    if (currentRefreshState == LOW && refreshHoldStart > 0) {
+        unsigned long holdDuration = currentTime - refreshHoldStart;
+
+        // If held long enough and not already showing forecast, show it
+        if (holdDuration >= HOLD_THRESHOLD && !isShowingForecast) {
+            isShowingForecast = true;
+            Serial.println("Hold detected - showing forecast view");
+
+            // Show cached forecast right away; it is redrawn when the fetch completes
+            drawForecastView();
+            queueFetchRequest(REQUEST_FORECAST);
+        }
+    }
+
+    // Button released (transition from LOW to HIGH)
+    if (currentRefreshState == HIGH && lastRefreshState == LOW) {
+        unsigned long holdDuration = currentTime - refreshHoldStart;
+
+        // If we were showing forecast, return to main screen
+        if (isShowingForecast) {
+            isShowingForecast = false;
+            Serial.println("Button released - returning to main screen");
+            redrawMainScreen();
+        }
+        // Short press (not held long enough for forecast) - do normal refresh
+        else if (holdDuration < HOLD_THRESHOLD && holdDuration > 0) {
+            lastRefreshPress = currentTime;
+            Serial.println("Manual refresh triggered");
+
+            // Force immediate refresh of all data (results arrive through processFetchResults)
+            if (fetchTime(time(NULL))) {
+                updateTimeDisplay();
+            }
+            queueFetchRequest(REQUEST_REFRESH_ALL);
+        }
+
+        refreshHoldStart = 0;  // Reset hold tracking
+    }
+
+    lastRefreshState = currentRefreshState;
+}
+
+
+
+void setup() {
+    Serial.begin(115200);
+    Serial.println("ESP32 Status Screen Starting...");
+    loopTaskHandle = xTaskGetCurrentTaskHandle();  // setup() and loop() share the Arduino loop task
     
+    // Stage 1: display. Buttons and backlight first so the first frame is visible
     pinMode(BUTTON_PIN, INPUT_PULLUP);  // Enable internal pullup resistor
     pinMode(SCREEN_TOGGLE_PIN, INPUT_PULLUP);
     pinMode(REFRESH_PIN, INPUT_PULLUP);
     pinMode(TFT_BL, OUTPUT);
     digitalWrite(TFT_BL, HIGH);  // Turn on backlight
-
-    setupNTP();
     
-    // Initialize printer structures
-    sovolPrinter.name = "Sovol";
-    sovolPrinter.host = "sovol.lan";
-    sovolPrinter.status = "offline";
-    sovolPrinter.lastStatus = "offline";
-    sovolPrinter.isFlashing = false;
-    sovolPrinter.flashStartTime = 0;
-    mandrainPrinter.name = "Mandrain";
-    mandrainPrinter.host = "mandrainpi.lan";
-    mandrainPrinter.status = "offline";
-    mandrainPrinter.lastStatus = "offline";
-    mandrainPrinter.isFlashing = false;
-    mandrainPrinter.flashStartTime = 0;
-    
-    // Show initial display with WiFi status
+    tft.init();
+    tft.setRotation(0);
     tft.fillScreen(BACKGROUND);
-    tft.setTextSize(2);
-    tft.setTextColor(TFT_WHITE);
-    tft.drawString("ESP32 Status Screen", 20, 50);
-    
-    bool timeSuccess = false;
-    bool stockSuccess = false;
-    bool weatherSuccess = false;
-    bool coffeeSuccess = false;
-    bool trailSuccess = false;
-    
-    if (WiFi.status() == WL_CONNECTED) {
-        tft.setTextColor(TFT_GREEN);
-        tft.drawString("WiFi: Connected", 20, 100);
-        tft.setTextColor(TFT_WHITE);
-        tft.drawString("IP: " + WiFi.localIP().toString(), 20, 130);
-        
-        Serial.println("Starting data fetch...");
-        // More robust initial data fetch
-        timeSuccess = fetchTime() && fetchDate();
-        stockSuccess = fetchStockPrice();
-        weatherSuccess = fetchWeather();
-        coffeeSuccess = fetchCoffeeMachineStatus();
-        trailSuccess = fetchTrailStatus(mombaTrail, "momba") && 
-                       fetchTrailStatus(johnBryanTrail, "JohnBryan") &&
-                       fetchTrailStatus(caesarCreekTrail, "caesar_creek");
-    } else {
-        tft.setTextColor(TFT_RED);
-        tft.drawString("WiFi: Failed", 20, 100);
-        tft.setTextColor(TFT_YELLOW);
-        tft.drawString("Demo Mode", 20, 130);
-        
-        // Set demo data for testing display
-        currentTime.time = "12:34";
-        currentTime.seconds = "56";
-        currentTime.date = "Demo Mode Active";
-        spyStock.symbol = "SPY";
-        spyStock.price = 450.25;
-        spyStock.change = 2.15;
-        spyStock.changePercent = 0.48;
-        currentWeather.conditions = "Demo Weather";
-        currentWeather.temperature = 72;
-        currentWeather.humidity = 50;
-        currentWeather.icon = "01d";
-        coffeeMachine.status = "Demo";
-        coffeeMachine.esp32Status = "online";
-        mombaTrail.status = "open";
-        mombaTrail.lastUpdate = "Demo";
-        johnBryanTrail.status = "closed";
-        johnBryanTrail.lastUpdate = "Demo";
-        caesarCreekTrail.status = "wet";
-        caesarCreekTrail.lastUpdate = "Demo";
-        
-        Serial.println("Running in demo mode - no WiFi required");
-    }
-    
-    if (WiFi.status() == WL_CONNECTED) {
-        if (!timeSuccess || !stockSuccess || !weatherSuccess || !coffeeSuccess || !trailSuccess) {
-            Serial.println("Initial data fetch failed:");
-            Serial.println("Time: " + String(timeSuccess));
-            Serial.println("Stock: " + String(stockSuccess));
-            Serial.println("Weather: " + String(weatherSuccess));
-            Serial.println("Coffee: " + String(coffeeSuccess));
-            Serial.println("Trails: " + String(trailSuccess));
-        }
+    tft.setTextColor(TEXT_COLOR, BACKGROUND);
+    createCanvas();
+    fontMetricsBegin(tft);
+    buildClockGlyphs();
+    layoutWidgets();
+    markBootStage(BOOT_DISPLAY);
+    
+#ifdef BOOT_SELF_TEST
+    // Optional panel self-test (build with -DBOOT_SELF_TEST); costs 1.5 seconds
+    tft.fillScreen(TFT_RED);
+    delay(500);
+    tft.fillScreen(TFT_GREEN);
+    delay(500);
+    tft.fillScreen(TFT_BLUE);
+    delay(500);
+    tft.fillScreen(BACKGROUND);
+    Serial.println("Display test pattern completed");
+    if (canvas.created()) {
+        Serial.println(iconPackSelfTest(canvas) ? "Icon self-test passed"
+                                                : "Icon self-test FAILED: icon pixels did not reach the canvas");
     }
+#endif
     
-    // Update display regardless of fetch success
-    updateTimeDisplay();
-    updateStockDisplay();
-    updateWeatherDisplay();
-    updateCoffeeMachineDisplay();
-    updateTrailDisplay();
-    // updateCountdownDisplay();  // Hidden for now
-    
-    // Draw static weather icon
-    drawWeatherIconStatic();
-    
-    // Fetch and display printer status
-    if (WiFi.status() == WL_CONNECTED) {
-        fetchPrinterStatus(sovolPrinter);
-        fetchPrinterStatus(mandrainPrinter);
-    }
-    updatePrinterDisplay();
+    // Initialize printer structures
+    for (int i = 0; i < PRINTER_COUNT; i++) {
+        printers[i].name = printerConfig[i].name;
+        printers[i].host = printerConfig[i].host;
+        printers[i].status = "offline";
+        printers[i].lastStatus = "offline";
+        printers[i].isFlashing = false;
+        printers[i].flashStartTime = 0;
+    }
+    
+    // Stage 2: first frame. A warm boot shows the last-known state with the
+    // stale marker; a cold boot shows empty widgets that fill in as data arrives.
+    // The zone rule needs no network, so local time is right even without Wi-Fi
+    civilTimeBegin(TIME_ZONE);
+    restoreSnapshot();
+    redrawMainScreen();
+    markBootStage(BOOT_FIRST_FRAME);
+    
+    // Stage 3: Wi-Fi association runs in the background, from the cached AP
+    // when there is one. loop() drives it with wifiLinkPoll() and watches it via
+    // advanceBoot(), which starts NTP once it is up and falls back to demo data
+    // if it does not come up within BOOT_WIFI_TIMEOUT
+    Serial.print("Connecting to WiFi, SSID: ");
+    Serial.println(ssid);
+    wifiLinkBegin(ssid, password);
+    markBootStage(BOOT_WIFI_START);
     
-    lastTrailUpdate = millis();  // Initialize update timer
-    lastStockUpdate = millis();  // Initialize stock update timer
-    lastPrinterUpdate = millis();  // Initialize printer update timer
+    // Stage 4: the fetch worker waits for Wi-Fi itself, then runs every job at once
+    startFetchWorker();
 }
 
 void setupNTP() {
-    timeClient.begin();
-    // Set initial offset based on DST detection
-    // Will automatically adjust when DST changes (checked hourly)
-    cachedDSTOffset = getDSTOffset();
-    timeClient.setTimeOffset(cachedDSTOffset);
-    timeClient.update();
-    Serial.println("NTP initialized with offset: " + String(cachedDSTOffset/3600) + " hours (DST: " + 
-                   (cachedDSTOffset == -4 * 3600 ? "EDT" : "EST") + ")");
+    timeSyncBegin(NTP_SERVERS);
+    Serial.println("SNTP started, zone " + String(TIME_ZONE));
 }
 
 void loop() {
@@ -2272,132 +3073,58 @@ void loop() {
     handleScreenToggle();
     handleRefresh();
 
-    // Skip all display updates while showing forecast view
-    if (isShowingForecast) {
-        return;
-    }
-
-    // PRIORITY 2: Update time display every second (critical for keeping time current)
-    if (currentMillis - lastSecondUpdate >= SECOND_UPDATE_INTERVAL) {
-        if (fetchTime()) {
-            lastSecondUpdate = currentMillis;
+    // PRIORITY 2: Update time display on every seconds tick (critical for keeping time current)
+    // Ticks start once SNTP has set the clock and fire on the wall clock's second boundary,
+    // so they are handled before anything else can delay the digits
+    time_t tickSecond;
+    if (secondTickTake(tickSecond) && !isShowingForecast) {
+        if (fetchTime(tickSecond)) {
             updateTimeDisplay();
+            flushScreen();
         }
     }
-    
-    // PRIORITY 3: Update date every 30 seconds
-    if (currentMillis - lastTimeUpdate >= TIME_UPDATE_INTERVAL) {
-        if (fetchDate()) {
-            lastTimeUpdate = currentMillis;
-            updateTimeDisplay();
-            // updateCountdownDisplay();  // Hidden for now - Update countdown when date updates
-        }
-    }
-    
-    // Periodically redraw date to prevent it from being partially cleared by other elements
-    // Redraw every 2 minutes to ensure date stays fully visible
-    static unsigned long lastDateRedraw = 0;
-    if (currentMillis - lastDateRedraw >= 120000) { // 2 minutes
-        lastDateRedraw = currentMillis;
-        // Force date redraw by clearing the displayed date cache
-        lastDisplayedDate = "";  // Force redraw
-        updateTimeDisplay();
+
+    // Apply data fetched in the background by the worker on core 0
+    // (widgets are not redrawn while the forecast view is showing)
+    processFetchResults();
+    wifiLinkPoll();
+    advanceBoot();
+
+    // Skip all display updates while showing forecast view
+    if (isShowingForecast) {
+        processSerialInput();
+        waitForWork(INPUT_POLL_INTERVAL);
+        return;
     }
     
     // Animation disabled - weather icon is drawn statically
     
-    // PRIORITY 5: Periodic updates (these can block, but time updates will catch up)
-    // Only do ONE blocking operation per loop iteration to minimize time freeze
-    static int updateRotation = 0;  // Track which update to perform
-    updateRotation = (updateRotation + 1) % 4;  // Cycle through 4 different updates
-    
-    switch(updateRotation) {
-        case 0:
-            // Stock updates (every 5 minutes)
-            if (currentMillis - lastStockUpdate >= STOCK_UPDATE_INTERVAL) {
-                Serial.println("Attempting stock update..."); // Debug print
-                if (fetchStockPrice()) {
-                    lastStockUpdate = currentMillis;
-                    updateStockDisplay();
-                    // Redraw date after stock update to ensure it's not partially cleared
-                    if (currentRotation == 1 || currentRotation == 3) { // Landscape only
-                        lastDisplayedDate = "";  // Force date redraw
-                        updateTimeDisplay();
-                    }
-                    Serial.println("Stock update successful");
-                } else {
-                    Serial.println("Stock update failed");
-                }
-            }
-            break;
-            
-        case 1:
-            // Weather updates (every 30 minutes)
-            if (currentMillis - lastWeatherUpdate >= WEATHER_UPDATE_INTERVAL) {
-                Serial.println("Attempting weather update..."); // Debug print
-                if (fetchWeather()) {
-                    lastWeatherUpdate = currentMillis;
-                    updateWeatherDisplay();
-                    Serial.println("Weather update successful");
-                } else {
-                    Serial.println("Weather update failed");
-                }
-            }
-            break;
-            
-        case 2:
-            // Coffee machine updates (every 5 minutes)
-            if (currentMillis - lastCoffeeUpdate >= COFFEE_UPDATE_INTERVAL) {
-                Serial.println("Attempting coffee machine update..."); // Debug print
-                if (fetchCoffeeMachineStatus()) {
-                    lastCoffeeUpdate = currentMillis;
-                    updateCoffeeMachineDisplay();
-                    Serial.println("Coffee machine update successful");
-                } else {
-                    Serial.println("Coffee machine update failed");
-                }
-            }
-            break;
-            
-        case 3:
-            // Trail status updates (every 5 minutes)
-            if (currentMillis - lastTrailUpdate >= TRAIL_UPDATE_INTERVAL) {
-                Serial.println("Attempting trail status update..."); // Debug print
-                bool updateSuccess = fetchTrailStatus(mombaTrail, "momba") && 
-                                   fetchTrailStatus(johnBryanTrail, "JohnBryan") &&
-                                   fetchTrailStatus(caesarCreekTrail, "caesar_creek");
-                                   
-                if (updateSuccess) {
-                    lastTrailUpdate = currentMillis;
-                    updateTrailDisplay();
-                    Serial.println("Trail status update successful");
-                } else {
-                    Serial.println("Trail status update failed");
-                }
-            }
-            break;
-    }
-    
-    // PRIORITY 6: Printer status updates (every 30 seconds)
-    if (currentMillis - lastPrinterUpdate >= PRINTER_UPDATE_INTERVAL) {
-        if (WiFi.status() == WL_CONNECTED) {
-            Serial.println("Attempting printer status update...");
-            fetchPrinterStatus(sovolPrinter);
-            fetchPrinterStatus(mandrainPrinter);
-            lastPrinterUpdate = currentMillis;
-            Serial.println("Printer status update completed");
-        }
-    }
-    
-    // PRIORITY 7: Update printer display (more frequently if flashing)
+    // PRIORITY 3: Update printer display (more frequently if flashing)
     // Update display more often when flashing to create smooth animation
     static unsigned long lastPrinterDisplayUpdate = 0;
-    unsigned long displayUpdateInterval = (sovolPrinter.isFlashing || mandrainPrinter.isFlashing) ? PRINTER_FLASH_INTERVAL : 1000;
+    bool anyPrinterFlashing = false;
+    for (int i = 0; i < PRINTER_COUNT; i++) {
+        anyPrinterFlashing = anyPrinterFlashing || printers[i].isFlashing;
+    }
+    unsigned long displayUpdateInterval = anyPrinterFlashing ? PRINTER_FLASH_INTERVAL : 1000;
     if (currentMillis - lastPrinterDisplayUpdate >= displayUpdateInterval) {
-        updatePrinterDisplay();
+        regionInvalidate(WIDGET_PRINTERS);
         lastPrinterDisplayUpdate = currentMillis;
     }
     
     processSerialInput();
-    delay(10);  // Small delay for stability
+    flushScreen();
+
+    // Flash writes are coalesced: at most one per SNAPSHOT_MIN_INTERVAL, and none if nothing changed
+    if (snapshotDirty && snapshotDue()) {
+        saveSnapshot();
+        snapshotDirty = false;
+    }
+
+    // Sleep until the next display deadline; a posted fetch result or seconds tick
+    // wakes us early and the buttons are still polled every INPUT_POLL_INTERVAL
+    unsigned long now = millis();
+    unsigned long wait = INPUT_POLL_INTERVAL;
+    wait = min(wait, timeUntil(lastPrinterDisplayUpdate, displayUpdateInterval, now));
+    waitForWork(wait);
 }
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "scheduler.h"
+#include <limits.h>
+
+struct SchedulerJob {
+    const char *name;
+    SchedulerJobFunction run;
+    unsigned long interval;
+    unsigned long jitter;
+    unsigned long retryDelay;
+    uint8_t priority;
+    unsigned long deadline;   // millis() when the job is next due
+    int heapIndex;            // Position in heap, -1 while the job is running
+    int failStreak;           // Consecutive failed runs; each one doubles the retry delay
+
+    // Counters for the "health" serial command
+    unsigned long runs;
+    unsigned long failures;
+    unsigned long lastDuration;  // ms spent in the last run
+    unsigned long maxLateness;   // Worst ms between deadline and start
+};
+
+static SchedulerJob jobs[SCHEDULER_MAX_JOBS];
+static int jobCount = 0;
+
+// Min-heap of job ids ordered by deadline
+static int heap[SCHEDULER_MAX_JOBS];
+static int heapSize = 0;
+
+// Deadlines are millis() values, so compare through the signed difference to survive rollover
+static bool earlier(int a, int b) {
+    return (long)(jobs[a].deadline - jobs[b].deadline) < 0;
+}
+
+static void place(int index, int job) {
+    heap[index] = job;
+    jobs[job].heapIndex = index;
+}
+
+static void siftUp(int index) {
+    int job = heap[index];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (!earlier(job, heap[parent])) {
+            break;
+        }
+        place(index, heap[parent]);
+        index = parent;
+    }
+    place(index, job);
+}
+
+static void siftDown(int index) {
+    int job = heap[index];
+    for (;;) {
+        int child = 2 * index + 1;
+        if (child >= heapSize) {
+            break;
+        }
+        if (child + 1 < heapSize && earlier(heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!earlier(heap[child], job)) {
+            break;
+        }
+        place(index, heap[child]);
+        index = child;
+    }
+    place(index, job);
+}
+
+static int popEarliest() {
+    int job = heap[0];
+    jobs[job].heapIndex = -1;
+    heapSize--;
+    if (heapSize > 0) {
+        place(0, heap[heapSize]);
+        siftDown(0);
+    }
+    return job;
+}
+
+// Insert a job, or move it if its deadline changed while queued
+static void queueJob(int job) {
+    int index = jobs[job].heapIndex;
+    if (index < 0) {
+        index = heapSize++;
+        place(index, job);
+        siftUp(index);
+    } else {
+        siftUp(index);
+        siftDown(jobs[job].heapIndex);
+    }
+}
+
+int schedulerAddJob(const char *name, SchedulerJobFunction run, unsigned long interval,
+                    unsigned long jitter, unsigned long retryDelay, uint8_t priority) {
+    if (jobCount >= SCHEDULER_MAX_JOBS) {
+        Serial.println("Scheduler full, cannot add job " + String(name));
+        return -1;
+    }
+    int job = jobCount++;
+    SchedulerJob &entry = jobs[job];
+    entry.name = name;
+    entry.run = run;
+    entry.interval = interval;
+    entry.jitter = jitter;
+    entry.retryDelay = retryDelay < interval ? retryDelay : interval;
+    entry.priority = priority;
+    entry.deadline = millis();
+    entry.heapIndex = -1;
+    entry.failStreak = 0;
+    entry.runs = 0;
+    entry.failures = 0;
+    entry.lastDuration = 0;
+    entry.maxLateness = 0;
+    queueJob(job);
+    return job;
+}
+
+int schedulerRunDue(unsigned long now, int budget, void *arg) {
+    // Take every due job off the heap, then order by priority. Insertion sort is
+    // stable, so equal priorities keep their deadline order.
+    int due[SCHEDULER_MAX_JOBS];
+    int dueCount = 0;
+    while (heapSize > 0 && (long)(now - jobs[heap[0]].deadline) >= 0) {
+        int job = popEarliest();
+        int i = dueCount++;
+        while (i > 0 && jobs[due[i - 1]].priority < jobs[job].priority) {
+            due[i] = due[i - 1];
+            i--;
+        }
+        due[i] = job;
+    }
+
+    int ran = 0;
+    for (int i = 0; i < dueCount; i++) {
+        int job = due[i];
+        if (ran >= budget) {
+            // Over budget: stays due for the next call. A job that ran earlier in
+            // this pass may already have requeued it (schedulerComplete).
+            if (jobs[job].heapIndex < 0) {
+                queueJob(job);
+            }
+            continue;
+        }
+        SchedulerJob &entry = jobs[job];
+        unsigned long start = millis();
+        unsigned long lateness = start - entry.deadline;
+        if ((long)lateness > 0 && lateness > entry.maxLateness) {
+            entry.maxLateness = lateness;
+        }
+        bool ok = entry.run(arg);
+        entry.lastDuration = millis() - start;
+        entry.runs++;
+        schedulerComplete(job, ok, millis());
+        ran++;
+    }
+    return ran;
+}
+
+void schedulerComplete(int job, bool success, unsigned long now) {
+    if (job < 0 || job >= jobCount) {
+        return;
+    }
+    SchedulerJob &entry = jobs[job];
+    if (success) {
+        entry.failStreak = 0;
+        entry.deadline = now + entry.interval + (entry.jitter > 0 ? random(entry.jitter + 1) : 0);
+    } else {
+        // Exponential backoff from retryDelay up to the job's own interval, with up
+        // to 25% jitter so jobs failing together do not retry together
+        entry.failures++;
+        int doublings = entry.failStreak < SCHEDULER_MAX_DOUBLINGS ? entry.failStreak : SCHEDULER_MAX_DOUBLINGS;
+        entry.failStreak++;
+        unsigned long backoff = entry.retryDelay << doublings;
+        if (backoff > entry.interval) {
+            backoff = entry.interval;
+        }
+        entry.deadline = now + backoff + random(backoff / 4 + 1);
+    }
+    queueJob(job);
+}
+
+void schedulerExpedite(int job, unsigned long now) {
+    if (job < 0 || job >= jobCount) {
+        return;
+    }
+    jobs[job].deadline = now;
+    queueJob(job);
+}
+
+unsigned long schedulerTimeUntilNext(unsigned long now) {
+    if (heapSize == 0) {
+        return ULONG_MAX;
+    }
+    long remaining = (long)(jobs[heap[0]].deadline - now);
+    return remaining > 0 ? (unsigned long)remaining : 0;
+}
+
+void schedulerPrintStats() {
+    Serial.println("Scheduler: " + String(jobCount) + " jobs");
+    for (int i = 0; i < jobCount; i++) {
+        const SchedulerJob &entry = jobs[i];
+        long next = (long)(entry.deadline - millis()) / 1000;
+        Serial.println("  " + String(entry.name) + ": " + String(entry.runs) + " runs, " +
+                       String(entry.failures) + " failures" +
+                       (entry.failStreak > 0 ? " (" + String(entry.failStreak) + " in a row, backing off)" : String("")) +
+                       ", last " + String(entry.lastDuration) + "ms, " +
+                       "max late " + String(entry.maxLateness) + "ms, next in " + String(next > 0 ? next : 0) + "s");
+    }
+}
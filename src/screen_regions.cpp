@@ -0,0 +1,168 @@
+#include "screen_regions.h"
+
+struct RegionWidget {
+    ScreenRect bounds;
+    RegionDrawFunction draw;   // NULL for unused ids
+};
+
+static RegionWidget widgets[REGION_MAX_WIDGETS];
+static int widgetLimit = 0;    // One past the highest registered id
+
+static ScreenRect dirty[REGION_MAX_DIRTY];
+static int dirtyCount = 0;
+static ScreenRect damage = {0, 0, 0, 0};   // Dirty part of the widget being repainted
+
+// Counters for the "stats" serial command
+static unsigned long flushCount = 0;
+static unsigned long drawCount = 0;
+static unsigned long cascadeCount = 0;   // Repaints caused only by an overlapping widget
+static unsigned long mergeCount = 0;
+static unsigned long pixelCount = 0;
+
+static bool isEmpty(const ScreenRect &r) {
+    return r.w <= 0 || r.h <= 0;
+}
+
+static bool intersects(const ScreenRect &a, const ScreenRect &b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static ScreenRect unite(const ScreenRect &a, const ScreenRect &b) {
+    int16_t left = min(a.x, b.x);
+    int16_t top = min(a.y, b.y);
+    int16_t right = max(a.x + a.w, b.x + b.w);
+    int16_t bottom = max(a.y + a.h, b.y + b.h);
+    return {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+}
+
+ScreenRect regionIntersection(const ScreenRect &a, const ScreenRect &b) {
+    int16_t left = max(a.x, b.x);
+    int16_t top = max(a.y, b.y);
+    int16_t right = min(a.x + a.w, b.x + b.w);
+    int16_t bottom = min(a.y + a.h, b.y + b.h);
+    return {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+}
+
+static bool intersectsAny(const ScreenRect *list, int count, const ScreenRect &rect) {
+    for (int i = 0; i < count; i++) {
+        if (intersects(list[i], rect)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Add rect to list, merging it with every rectangle it overlaps. A merged
+// rectangle can reach ones it did not overlap before, so merging repeats.
+static void addRect(ScreenRect *list, int &count, ScreenRect rect) {
+    if (isEmpty(rect)) {
+        return;
+    }
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < count; i++) {
+            if (intersects(list[i], rect)) {
+                rect = unite(list[i], rect);
+                list[i] = list[--count];
+                mergeCount++;
+                merged = true;
+                break;
+            }
+        }
+    }
+    if (count == REGION_MAX_DIRTY) {
+        list[count - 1] = unite(list[count - 1], rect);
+        mergeCount++;
+    } else {
+        list[count++] = rect;
+    }
+}
+
+void regionSetWidget(int id, const ScreenRect &bounds, RegionDrawFunction draw) {
+    if (id < 0 || id >= REGION_MAX_WIDGETS) {
+        return;
+    }
+    widgets[id].bounds = bounds;
+    widgets[id].draw = draw;
+    if (id >= widgetLimit) {
+        widgetLimit = id + 1;
+    }
+}
+
+const ScreenRect &regionDamage() {
+    return damage;
+}
+
+const ScreenRect &regionBounds(int id) {
+    return widgets[id].bounds;
+}
+
+void regionInvalidate(int id) {
+    if (id >= 0 && id < widgetLimit && widgets[id].draw != NULL) {
+        addRect(dirty, dirtyCount, widgets[id].bounds);
+    }
+}
+
+void regionInvalidateRect(const ScreenRect &rect) {
+    addRect(dirty, dirtyCount, rect);
+}
+
+void regionInvalidateAll() {
+    for (int id = 0; id < widgetLimit; id++) {
+        regionInvalidate(id);
+    }
+}
+
+bool regionPending() {
+    return dirtyCount > 0;
+}
+
+int regionFlush() {
+    if (dirtyCount == 0) {
+        return 0;
+    }
+    // Work on a copy: a widget may invalidate something while it paints, and
+    // that belongs to the next flush. The copy grows as widgets are painted;
+    // the dirty set as it was tells repaints that were asked for from cascades
+    ScreenRect requested[REGION_MAX_DIRTY];
+    int requestedCount = dirtyCount;
+    memcpy(requested, dirty, sizeof(ScreenRect) * dirtyCount);
+    ScreenRect pending[REGION_MAX_DIRTY];
+    int pendingCount = dirtyCount;
+    memcpy(pending, dirty, sizeof(ScreenRect) * dirtyCount);
+    dirtyCount = 0;
+
+    int drawn = 0;
+    for (int id = 0; id < widgetLimit; id++) {
+        RegionWidget &widget = widgets[id];
+        if (widget.draw == NULL || isEmpty(widget.bounds) || !intersectsAny(pending, pendingCount, widget.bounds)) {
+            continue;
+        }
+        if (!intersectsAny(requested, requestedCount, widget.bounds)) {
+            cascadeCount++;
+        }
+        damage = {0, 0, 0, 0};
+        for (int i = 0; i < pendingCount; i++) {
+            if (intersects(pending[i], widget.bounds)) {
+                ScreenRect part = regionIntersection(pending[i], widget.bounds);
+                damage = isEmpty(damage) ? part : unite(damage, part);
+            }
+        }
+        widget.draw();
+        drawn++;
+        pixelCount += (unsigned long)damage.w * damage.h;
+        // Widgets above this one that overlap what it painted have just been painted over
+        addRect(pending, pendingCount, damage);
+    }
+    damage = {0, 0, 0, 0};
+    flushCount++;
+    drawCount += drawn;
+    return drawn;
+}
+
+void regionsPrintStats() {
+    Serial.println("Screen regions: " + String(flushCount) + " flushes, " + String(drawCount) + " widget repaints (" +
+                   String(cascadeCount) + " for overlaps), " + String(mergeCount) + " rect merges, " +
+                   String(pixelCount) + " pixels");
+}
@@ -0,0 +1,87 @@
+#include "second_tick.h"
+#include <sys/time.h>
+#include <freertos/queue.h>
+#include "esp_timer.h"
+
+static esp_timer_handle_t tickTimer = NULL;
+static QueueHandle_t tickQueue = NULL;  // Length 1: the latest tick replaces an untaken one
+static TaskHandle_t tickTask = NULL;
+
+// Counters for the "stats" serial command (missed is written by the timer task)
+static volatile unsigned long ticksMissed = 0;
+static unsigned long ticksTaken = 0;
+static unsigned long ticksLate = 0;
+static long latenessMax = 0;      // us after the boundary
+static int64_t latenessSum = 0;   // For the average
+
+// Arm the timer for the next boundary and return the second this tick stands
+// for. A timer that fires a little before its boundary (the clock may be
+// slewing faster than esp_timer) stands for the coming second.
+static time_t armTick() {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    time_t second = now.tv_sec;
+    long untilNext = 1000000 - now.tv_usec;
+    if (now.tv_usec > 500000) {
+        second = now.tv_sec + 1;
+        untilNext += 1000000;
+    }
+    esp_timer_start_once(tickTimer, untilNext);
+    return second;
+}
+
+static void onTick(void *arg) {
+    time_t second = armTick();
+    if (uxQueueMessagesWaiting(tickQueue) > 0) {
+        ticksMissed++;  // The previous tick was never taken
+    }
+    xQueueOverwrite(tickQueue, &second);
+    xTaskNotifyGive(tickTask);
+}
+
+void secondTickBegin(TaskHandle_t notify) {
+    if (tickTimer != NULL) {
+        return;
+    }
+    tickTask = notify;
+    tickQueue = xQueueCreate(1, sizeof(time_t));
+    esp_timer_create_args_t args = {};
+    args.callback = onTick;
+    args.name = "secondTick";
+    esp_timer_create(&args, &tickTimer);
+    armTick();
+}
+
+bool secondTickTake(time_t &second) {
+    if (tickQueue == NULL || xQueueReceive(tickQueue, &second, 0) != pdTRUE) {
+        return false;
+    }
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    long lateness = (long)(now.tv_sec - second) * 1000000 + now.tv_usec;
+    if (lateness < 0) {
+        lateness = 0;  // Taken in the last moments before a slewed boundary
+    }
+    ticksTaken++;
+    latenessSum += lateness;
+    if (lateness > latenessMax) {
+        latenessMax = lateness;
+    }
+    if (lateness > SECOND_TICK_LATE_US) {
+        ticksLate++;
+    }
+    return true;
+}
+
+void secondTickPrintStats() {
+    Serial.println("Seconds ticks: " + String(ticksTaken) + ", late: " + String(ticksLate) +
+                   ", missed: " + String(ticksMissed) + ", lateness avg: " +
+                   String(ticksTaken > 0 ? (long)(latenessSum / ticksTaken) / 1000.0 : 0.0, 1) + "ms, max: " +
+                   String(latenessMax / 1000.0, 1) + "ms");
+    // Start a new measurement window
+    ticksTaken = 0;
+    ticksLate = 0;
+    ticksMissed = 0;
+    latenessMax = 0;
+    latenessSum = 0;
+}
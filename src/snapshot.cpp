@@ -0,0 +1,166 @@
+#include "snapshot.h"
+#include <Preferences.h>
+
+static const char *SNAPSHOT_NAMESPACE = "snapshot";
+static const char *SNAPSHOT_KEY = "widgets";
+
+// Copy of the stored bytes, so unchanged state never reaches the flash
+static uint8_t stored[SNAPSHOT_MAX_SIZE];
+static size_t storedLength = 0;
+static unsigned long lastWriteAt = 0;
+static bool written = false;  // A write happened since boot (lastWriteAt is valid)
+
+// Counters for the "stats" serial command
+static unsigned long snapshotWrites = 0;
+static unsigned long snapshotSkipped = 0;  // Save requests with nothing new to write
+
+SnapshotWriter::SnapshotWriter() : used(0), overflow(false) {
+    writeByte(SNAPSHOT_VERSION);
+}
+
+void SnapshotWriter::write(const void *bytes, size_t count) {
+    if (used + count > SNAPSHOT_MAX_SIZE) {
+        overflow = true;
+        return;
+    }
+    memcpy(buffer + used, bytes, count);
+    used += count;
+}
+
+void SnapshotWriter::writeByte(uint8_t value) {
+    write(&value, 1);
+}
+
+void SnapshotWriter::writeInt16(int16_t value) {
+    write(&value, sizeof(value));
+}
+
+void SnapshotWriter::writeFloat(float value) {
+    write(&value, sizeof(value));
+}
+
+void SnapshotWriter::writeString(const String &value) {
+    size_t count = value.length() < 255 ? value.length() : 255;
+    writeByte((uint8_t)count);
+    write(value.c_str(), count);
+}
+
+bool SnapshotWriter::overflowed() const {
+    return overflow;
+}
+
+const uint8_t *SnapshotWriter::data() const {
+    return buffer;
+}
+
+size_t SnapshotWriter::length() const {
+    return used;
+}
+
+SnapshotReader::SnapshotReader(const uint8_t *bytes, size_t count)
+    : data(bytes), length(count), position(0), valid(true) {
+}
+
+bool SnapshotReader::read(void *bytes, size_t count) {
+    if (!valid || position + count > length) {
+        valid = false;
+        memset(bytes, 0, count);
+        return false;
+    }
+    memcpy(bytes, data + position, count);
+    position += count;
+    return true;
+}
+
+uint8_t SnapshotReader::readByte() {
+    uint8_t value;
+    read(&value, 1);
+    return value;
+}
+
+int16_t SnapshotReader::readInt16() {
+    int16_t value;
+    read(&value, sizeof(value));
+    return value;
+}
+
+float SnapshotReader::readFloat() {
+    float value;
+    read(&value, sizeof(value));
+    return value;
+}
+
+String SnapshotReader::readString() {
+    uint8_t count = readByte();
+    if (!valid || position + count > length) {
+        valid = false;
+        return "";
+    }
+    String value;
+    value.reserve(count);
+    for (uint8_t i = 0; i < count; i++) {
+        value += (char)data[position + i];
+    }
+    position += count;
+    return value;
+}
+
+bool SnapshotReader::ok() const {
+    return valid;
+}
+
+size_t snapshotLoad(uint8_t *buffer, size_t size) {
+    Preferences prefs;
+    if (!prefs.begin(SNAPSHOT_NAMESPACE, true)) {
+        return 0;  // Namespace does not exist yet: first boot
+    }
+    size_t length = prefs.getBytesLength(SNAPSHOT_KEY);
+    if (length > 0 && length <= SNAPSHOT_MAX_SIZE) {
+        storedLength = prefs.getBytes(SNAPSHOT_KEY, stored, length);
+    }
+    prefs.end();
+
+    if (storedLength < 1 || stored[0] != SNAPSHOT_VERSION || storedLength - 1 > size) {
+        return 0;
+    }
+    memcpy(buffer, stored + 1, storedLength - 1);
+    return storedLength - 1;
+}
+
+bool snapshotDue() {
+    return !written || millis() - lastWriteAt >= SNAPSHOT_MIN_INTERVAL;
+}
+
+void snapshotSave(const SnapshotWriter &writer) {
+    if (writer.overflowed()) {
+        Serial.println("Snapshot larger than " + String(SNAPSHOT_MAX_SIZE) + " bytes, not saved");
+        return;
+    }
+    if (writer.length() == storedLength && memcmp(writer.data(), stored, storedLength) == 0) {
+        snapshotSkipped++;
+        return;
+    }
+
+    // Count the attempt either way, so a failing flash is not retried every loop()
+    written = true;
+    lastWriteAt = millis();
+
+    Preferences prefs;
+    size_t saved = 0;
+    if (prefs.begin(SNAPSHOT_NAMESPACE, false)) {
+        saved = prefs.putBytes(SNAPSHOT_KEY, writer.data(), writer.length());
+        prefs.end();
+    }
+    if (saved == writer.length()) {
+        memcpy(stored, writer.data(), writer.length());
+        storedLength = writer.length();
+        snapshotWrites++;
+    } else {
+        Serial.println("Snapshot write failed");
+    }
+}
+
+void snapshotPrintStats() {
+    Serial.println("Snapshot: " + String(snapshotWrites) + " writes, " + String(snapshotSkipped) +
+                   " unchanged, " + String(storedLength) + " bytes stored");
+}
@@ -0,0 +1,252 @@
+#include "sse_client.h"
+#include "dns_cache.h"
+
+SseClient::SseClient(const char *host, uint16_t port, const char *path, EventHandler handler)
+    : host(host), port(port), path(path), handler(handler), state(IDLE), stateSince(0),
+      lastActivity(0), retryAt(0), retryDelay(SSE_RETRY_MIN), reconnected(false), chunked(false),
+      chunkState(CHUNK_SIZE), chunkRemaining(0), chunkExtension(false), lineTooLong(false),
+      statusCode(0), dropEvent(false), eventCount(0), connectCount(0) {
+}
+
+void SseClient::connect() {
+    IPAddress ip;
+    if (!dnsCacheResolve(host, ip)) {
+        backoff();
+        return;
+    }
+    if (!client.connect(ip, port, SSE_CONNECT_TIMEOUT)) {
+        Serial.println("Event stream connect to " + String(host) + " failed");
+        dnsCacheInvalidate(host);
+        backoff();
+        return;
+    }
+    client.print(String("GET ") + path + " HTTP/1.1\r\n" +
+                 "Host: " + host + "\r\n" +
+                 "Accept: text/event-stream\r\n" +
+                 "Cache-Control: no-cache\r\n" +
+                 "Connection: keep-alive\r\n\r\n");
+
+    state = READING_HEADERS;
+    stateSince = millis();
+    lastActivity = stateSince;
+    statusCode = 0;
+    chunked = false;
+    chunkState = CHUNK_SIZE;
+    chunkRemaining = 0;
+    chunkExtension = false;
+    line = "";
+    lineTooLong = false;
+    eventName = "";
+    eventData = "";
+    dropEvent = false;
+}
+
+// Close the socket and schedule the next attempt
+void SseClient::fail(unsigned long delayMs) {
+    client.stop();
+    state = IDLE;
+    stateSince = millis();
+    retryAt = stateSince + delayMs;
+}
+
+void SseClient::backoff() {
+    fail(retryDelay);
+    retryDelay = retryDelay * 2 > SSE_RETRY_MAX ? SSE_RETRY_MAX : retryDelay * 2;
+}
+
+void SseClient::stop() {
+    fail(SSE_RETRY_MIN);
+}
+
+void SseClient::poll() {
+    if (state == IDLE) {
+        if ((long)(millis() - retryAt) >= 0) {
+            connect();
+        }
+        return;
+    }
+
+    // Bounded per call so a burst of events cannot starve the worker's request queue
+    int budget = 512;
+    while (budget-- > 0 && state != IDLE && client.available() > 0) {
+        int c = client.read();
+        if (c < 0) {
+            break;
+        }
+        lastActivity = millis();
+        receive((char)c);
+    }
+    if (state == IDLE) {
+        return;
+    }
+
+    unsigned long now = millis();
+    if (!client.connected() && client.available() == 0) {
+        Serial.println("Event stream closed by server");
+        backoff();
+    } else if (state == READING_HEADERS && now - stateSince >= SSE_CONNECT_TIMEOUT) {
+        Serial.println("Event stream: no response headers");
+        backoff();
+    } else if (state == STREAMING && now - lastActivity >= SSE_STALE_TIMEOUT) {
+        Serial.println("Event stream stale, reconnecting");
+        backoff();
+    }
+}
+
+bool SseClient::healthy() const {
+    return state == STREAMING && millis() - lastActivity < SSE_STALE_TIMEOUT;
+}
+
+bool SseClient::takeReconnected() {
+    bool value = reconnected;
+    reconnected = false;
+    return value;
+}
+
+// Raw socket byte: header line, chunk framing or event stream payload
+void SseClient::receive(char c) {
+    if (state == READING_HEADERS) {
+        if (c == '\n') {
+            processHeaderLine();
+            line = "";
+        } else if (c != '\r' && line.length() < SSE_MAX_LINE) {
+            line += c;
+        }
+        return;
+    }
+    if (!chunked) {
+        feed(c);
+        return;
+    }
+
+    switch (chunkState) {
+        case CHUNK_SIZE:
+            if (c == '\n') {
+                if (chunkRemaining == 0) {
+                    Serial.println("Event stream ended by server");
+                    backoff();
+                } else {
+                    chunkState = CHUNK_DATA;
+                }
+            } else if (c == ';') {
+                chunkExtension = true;
+            } else if (!chunkExtension && isxdigit((unsigned char)c)) {
+                chunkRemaining = chunkRemaining * 16 + (isdigit((unsigned char)c) ? c - '0' : (tolower(c) - 'a' + 10));
+            }
+            break;
+        case CHUNK_DATA:
+            feed(c);
+            if (--chunkRemaining == 0) {
+                chunkState = CHUNK_DATA_END;
+            }
+            break;
+        case CHUNK_DATA_END:
+            // CRLF after the chunk data
+            if (c == '\n') {
+                chunkState = CHUNK_SIZE;
+                chunkRemaining = 0;
+                chunkExtension = false;
+            }
+            break;
+    }
+}
+
+void SseClient::processHeaderLine() {
+    if (statusCode == 0) {
+        // "HTTP/1.1 200 OK"
+        int space = line.indexOf(' ');
+        statusCode = space > 0 ? line.substring(space + 1).toInt() : -1;
+        return;
+    }
+    if (line.length() > 0) {
+        String lower = line;
+        lower.toLowerCase();
+        if (lower.startsWith("transfer-encoding:") && lower.indexOf("chunked") > 0) {
+            chunked = true;
+        }
+        return;
+    }
+
+    // Blank line: end of headers
+    if (statusCode == 200) {
+        Serial.println("Event stream connected to " + String(host) + path);
+        state = STREAMING;
+        stateSince = millis();
+        retryDelay = SSE_RETRY_MIN;
+        reconnected = true;
+        connectCount++;
+    } else if (statusCode == 404) {
+        Serial.println("Server has no " + String(path) + ", polling only");
+        fail(SSE_UNSUPPORTED_RETRY);
+    } else {
+        Serial.println("Event stream rejected with code: " + String(statusCode));
+        backoff();
+    }
+}
+
+// Event stream payload byte
+void SseClient::feed(char c) {
+    if (c == '\n') {
+        processLine();
+        line = "";
+        lineTooLong = false;
+    } else if (c != '\r') {
+        if (line.length() < SSE_MAX_LINE) {
+            line += c;
+        } else {
+            lineTooLong = true;
+        }
+    }
+}
+
+void SseClient::processLine() {
+    if (line.length() == 0 && !lineTooLong) {
+        // Blank line dispatches the event
+        if (dropEvent) {
+            Serial.println("Event stream: dropped oversized " + (eventName.length() > 0 ? eventName : String("message")) + " event");
+        } else if (eventData.length() > 0) {
+            eventCount++;
+            handler(eventName.length() > 0 ? eventName : String("message"), eventData);
+        }
+        eventName = "";
+        eventData = "";
+        dropEvent = false;
+        return;
+    }
+    if (lineTooLong) {
+        dropEvent = true;
+        return;
+    }
+    if (line[0] == ':') {
+        return;  // Comment, used by the server as keepalive
+    }
+
+    int colon = line.indexOf(':');
+    String field = colon >= 0 ? line.substring(0, colon) : line;
+    String value = colon >= 0 ? line.substring(colon + 1) : String("");
+    if (value.startsWith(" ")) {
+        value = value.substring(1);
+    }
+
+    if (field == "event") {
+        eventName = value;
+    } else if (field == "data") {
+        if (eventData.length() + value.length() + 1 > SSE_MAX_LINE) {
+            dropEvent = true;
+        } else {
+            if (eventData.length() > 0) {
+                eventData += '\n';
+            }
+            eventData += value;
+        }
+    }
+    // id: and retry: are not used; reconnects always resync by polling
+}
+
+void SseClient::printStats() const {
+    const char *stateName = state == STREAMING ? (healthy() ? "streaming" : "stale") :
+                            state == READING_HEADERS ? "connecting" : "idle";
+    Serial.println("Event stream: " + String(stateName) + ", " + String(eventCount) + " events, " +
+                   String(connectCount) + " connects, last activity " +
+                   String(lastActivity > 0 ? (millis() - lastActivity) / 1000 : 0) + "s ago");
+}
@@ -0,0 +1,83 @@
+#include "text_runs.h"
+#include "font_metrics.h"
+
+// Counters for the "stats" serial command
+static unsigned long updateCount = 0;
+static unsigned long unchangedCount = 0;
+static unsigned long changedPixels = 0;   // Area returned for repaint
+static unsigned long linePixels = 0;      // Area a whole-line repaint would have covered
+
+// Step back to the first byte of the UTF-8 sequence holding byte index
+static int sequenceStart(const String &text, int index) {
+    while (index > 0 && index < (int)text.length() && (text[index] & 0xC0) == 0x80) {
+        index--;
+    }
+    return index;
+}
+
+static int widthOf(const String &text, int from, int to, uint8_t font) {
+    return to > from ? fontTextWidth(text, font, from, to) : 0;
+}
+
+ScreenRect textRunUpdate(TextRun &run, const String &text, uint16_t color, int x, int y, uint8_t font) {
+    int height = fontLineHeight(font);
+    int oldWidth = widthOf(run.text, 0, run.text.length(), run.font);
+    int newWidth = widthOf(text, 0, text.length(), font);
+    ScreenRect changed = {0, 0, 0, 0};
+    updateCount++;
+    linePixels += (unsigned long)max(oldWidth, newWidth) * height;
+
+    if (run.color != color || run.font != font || run.x != x || run.y != y) {
+        // Nothing on the panel can be kept: cover where the text was and where it goes
+        int16_t left = min(run.x, (int16_t)x);
+        int16_t top = min(run.y, (int16_t)y);
+        int16_t right = max(run.x + oldWidth, x + newWidth);
+        int16_t bottom = max(run.y + fontLineHeight(run.font), y + height);
+        if (oldWidth == 0) {
+            changed = {(int16_t)x, (int16_t)y, (int16_t)newWidth, (int16_t)height};
+        } else {
+            changed = {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+        }
+    } else if (run.text != text) {
+        int oldLength = run.text.length();
+        int newLength = text.length();
+        int first = 0;
+        while (first < oldLength && first < newLength && run.text[first] == text[first]) {
+            first++;
+        }
+        first = sequenceStart(text, first);
+        int suffix = 0;
+        while (suffix < oldLength - first && suffix < newLength - first &&
+               run.text[oldLength - 1 - suffix] == text[newLength - 1 - suffix]) {
+            suffix++;
+        }
+        // Keep whole UTF-8 sequences in the suffix
+        while (suffix > 0 && (text[newLength - suffix] & 0xC0) == 0x80) {
+            suffix--;
+        }
+        int left = widthOf(text, 0, first, font);
+        int oldMiddle = widthOf(run.text, first, oldLength - suffix, font);
+        int newMiddle = widthOf(text, first, newLength - suffix, font);
+        int right = (oldMiddle == newMiddle) ? left + newMiddle : max(oldWidth, newWidth);
+        if (right > left) {
+            changed = {(int16_t)(x + left), (int16_t)y, (int16_t)(right - left), (int16_t)height};
+        }
+    }
+
+    if (changed.w > 0) {
+        changedPixels += (unsigned long)changed.w * changed.h;
+    } else {
+        unchangedCount++;
+    }
+    run.text = text;
+    run.color = color;
+    run.x = x;
+    run.y = y;
+    run.font = font;
+    return changed;
+}
+
+void textRunsPrintStats() {
+    Serial.println("Text runs: " + String(updateCount) + " updates (" + String(unchangedCount) + " unchanged), " +
+                   String(changedPixels) + " of " + String(linePixels) + " line pixels repainted");
+}
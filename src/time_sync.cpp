@@ -0,0 +1,91 @@
+#include "time_sync.h"
+#include <sys/time.h>
+#include "esp_sntp.h"
+#include "esp_timer.h"
+
+// Written by the SNTP callback in the lwIP task, read from the other tasks
+static volatile bool synced = false;
+static volatile int64_t lastSyncTimer = 0;    // esp_timer_get_time() at the last sync (us)
+static volatile int64_t lastServerTime = 0;   // Server time at the last sync (us since epoch)
+
+// Counters for the "stats" serial command
+static volatile unsigned long syncCount = 0;
+static volatile unsigned long stepCount = 0;  // Syncs that set the clock instead of slewing it
+static volatile long lastOffset = 0;          // Server minus local clock at the last slewed sync (us)
+static volatile long maxOffset = 0;           // Largest slewed correction (us, absolute)
+static volatile float driftPpm = 0;           // Local timer rate error against the servers
+static volatile bool driftKnown = false;
+
+static int64_t toMicros(const struct timeval &tv) {
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// Called by SNTP after it has stepped the clock or started slewing it
+static void onTimeSync(struct timeval *tv) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    int64_t timer = esp_timer_get_time();
+    int64_t server = toMicros(*tv);
+
+    // Slewing has barely started, so the clock still reads the uncorrected time;
+    // after a step it already reads the server time and there is no offset to show
+    if (sntp_get_sync_status() == SNTP_SYNC_STATUS_IN_PROGRESS) {
+        long offset = (long)(server - toMicros(now));
+        lastOffset = offset;
+        if (labs(offset) > maxOffset) {
+            maxOffset = labs(offset);
+        }
+    } else {
+        stepCount++;
+    }
+
+    // The timer is never adjusted, so comparing it to the server's clock over a
+    // whole sync interval gives the crystal's own error
+    if (synced && timer > lastSyncTimer && server > lastServerTime) {
+        int64_t serverElapsed = server - lastServerTime;
+        int64_t timerElapsed = timer - lastSyncTimer;
+        driftPpm = (float)(timerElapsed - serverElapsed) * 1e6f / (float)serverElapsed;
+        driftKnown = true;
+    }
+    lastServerTime = server;
+    lastSyncTimer = timer;
+    syncCount++;
+    synced = true;
+}
+
+void timeSyncBegin(const char *const servers[TIME_SYNC_SERVER_COUNT]) {
+    if (sntp_enabled()) {
+        sntp_stop();
+    }
+    sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    int index = 0;
+    for (int i = 0; i < TIME_SYNC_SERVER_COUNT; i++) {
+        if (servers[i] != NULL) {
+            sntp_setservername(index++, servers[i]);
+        }
+    }
+    sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
+    sntp_set_sync_interval(TIME_SYNC_INTERVAL);
+    sntp_set_time_sync_notification_cb(onTimeSync);
+    sntp_init();
+}
+
+bool timeSyncValid() {
+    return synced;
+}
+
+void timeSyncPrintStats() {
+    if (!synced) {
+        Serial.println("Time sync: waiting for the first server reply");
+        return;
+    }
+    struct timeval pending;
+    adjtime(NULL, &pending);
+    unsigned long age = (unsigned long)((esp_timer_get_time() - lastSyncTimer) / 1000000);
+    Serial.println("Time sync: " + String(syncCount) + " syncs (" + String(stepCount) + " stepped), last " +
+                   String(age) + "s ago, last offset " + String(lastOffset / 1000.0, 1) + "ms, max " +
+                   String(maxOffset / 1000.0, 1) + "ms, slewing " + String(toMicros(pending) / 1000.0, 1) + "ms");
+    if (driftKnown) {
+        Serial.println("Clock drift: " + String(driftPpm, 1) + " ppm");
+    }
+}
@@ -0,0 +1,232 @@
+#include "wifi_link.h"
+#include <Preferences.h>
+
+static const char *WIFI_NAMESPACE = "wifi";
+static const char *WIFI_KEY = "link";
+
+enum LinkState { LINK_IDLE, LINK_JOINING, LINK_UP, LINK_LEAVING, LINK_WAITING };
+
+// What the last successful join learned, as stored in NVS
+struct LinkCache {
+    uint8_t bssid[6];
+    int32_t channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+};
+
+static const char *linkSsid;
+static const char *linkPassword;
+static LinkCache cache;
+static bool cacheValid = false;
+
+static LinkState state = LINK_IDLE;
+static bool fastJoin;                   // Current attempt uses the cache
+static bool skipFastJoin = false;       // The cache failed; scan until a scan join succeeds
+static unsigned long joinStartedAt;     // millis() the current attempt started
+static unsigned long leaveStartedAt;    // millis() a failed attempt was dropped
+static unsigned long leaveDelay;        // Wait before the next attempt once it is gone
+static unsigned long retryAt;           // millis() of the next attempt while waiting
+static unsigned long retryDelay = WIFI_RETRY_MIN;
+static unsigned long downSince = 0;     // millis() the link was lost, 0 while it never was
+
+// Set by the Wi-Fi event task, consumed by wifiLinkPoll()
+static volatile bool linkUp = false;
+static volatile bool eventGotIp = false;
+static volatile bool eventDisconnected = false;
+static volatile uint8_t lastDisconnectReason = 0;
+
+// Counters for the "stats" serial command
+static unsigned long fastJoins = 0;
+static unsigned long fullJoins = 0;
+static unsigned long joinFailures = 0;
+static unsigned long disconnects = 0;
+static unsigned long lastJoinTime = 0;   // ms from begin() to an address, last successful join
+static unsigned long lastOutage = 0;     // ms from disconnect to an address, last reconnect
+static unsigned long maxOutage = 0;
+
+static void onWifiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+    switch (event) {
+        case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+            eventGotIp = true;
+            break;
+        case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+            lastDisconnectReason = info.wifi_sta_disconnected.reason;
+            linkUp = false;
+            eventDisconnected = true;
+            break;
+        default:
+            break;
+    }
+}
+
+static void loadCache() {
+    Preferences prefs;
+    if (!prefs.begin(WIFI_NAMESPACE, true)) {
+        return;  // Never joined before
+    }
+    cacheValid = prefs.getBytesLength(WIFI_KEY) == sizeof(cache) &&
+                 prefs.getBytes(WIFI_KEY, &cache, sizeof(cache)) == sizeof(cache);
+    prefs.end();
+}
+
+// Remember the AP and lease of the current connection, writing NVS only on change
+static void saveCache() {
+    LinkCache current;
+    memcpy(current.bssid, WiFi.BSSID(), sizeof(current.bssid));
+    current.channel = WiFi.channel();
+    current.ip = (uint32_t)WiFi.localIP();
+    current.gateway = (uint32_t)WiFi.gatewayIP();
+    current.subnet = (uint32_t)WiFi.subnetMask();
+    current.dns = (uint32_t)WiFi.dnsIP();
+    if (cacheValid && memcmp(&current, &cache, sizeof(cache)) == 0) {
+        return;
+    }
+
+    cache = current;
+    cacheValid = true;
+    Preferences prefs;
+    if (prefs.begin(WIFI_NAMESPACE, false)) {
+        prefs.putBytes(WIFI_KEY, &cache, sizeof(cache));
+        prefs.end();
+        Serial.println("WiFi: cached AP " + WiFi.BSSIDstr() + " on channel " + String(cache.channel));
+    }
+}
+
+static void startJoin() {
+    fastJoin = cacheValid && !skipFastJoin;
+    eventGotIp = false;
+    eventDisconnected = false;
+    joinStartedAt = millis();
+    state = LINK_JOINING;
+
+    if (fastJoin) {
+        if (WIFI_REUSE_LEASE) {
+            WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+        } else {
+            WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);  // DHCP, so the lease is renewed
+        }
+        WiFi.begin(linkSsid, linkPassword, cache.channel, cache.bssid);
+    } else {
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);  // Back to DHCP
+        WiFi.begin(linkSsid, linkPassword);
+    }
+}
+
+// Drop the current attempt. The disconnect event it raises arrives later from
+// the event task; the next join starts only once that event (or
+// WIFI_LEAVE_TIMEOUT) has passed, so the event cannot abort it.
+static void leave(unsigned long delayMs) {
+    eventDisconnected = false;
+    WiFi.disconnect();
+    state = LINK_LEAVING;
+    leaveStartedAt = millis();
+    leaveDelay = delayMs;
+}
+
+// A join attempt failed or timed out: fall back from the cache, then back off
+static void joinFailed(const char *why) {
+    joinFailures++;
+    if (fastJoin) {
+        // The AP moved, changed channel or rejects the cached lease: scan right away
+        Serial.println("WiFi: fast join " + String(why) + ", scanning");
+        skipFastJoin = true;
+        leave(0);
+        return;
+    }
+    Serial.println("WiFi: join " + String(why) + " (reason " + String(lastDisconnectReason) +
+                   "), retrying in " + String(retryDelay / 1000) + "s");
+    leave(retryDelay);
+    retryDelay = min(retryDelay * 2, WIFI_RETRY_MAX);
+}
+
+void wifiLinkBegin(const char *ssid, const char *password) {
+    linkSsid = ssid;
+    linkPassword = password;
+    loadCache();
+
+    WiFi.persistent(false);        // The SDK's own flash copy of the config is not needed
+    WiFi.setAutoReconnect(false);  // Rejoins are driven from wifiLinkPoll()
+    WiFi.onEvent(onWifiEvent);
+    WiFi.mode(WIFI_STA);
+    startJoin();
+}
+
+void wifiLinkPoll() {
+    unsigned long now = millis();
+
+    if (state == LINK_LEAVING) {
+        if (eventDisconnected || now - leaveStartedAt >= WIFI_LEAVE_TIMEOUT) {
+            eventDisconnected = false;
+            state = LINK_WAITING;
+            retryAt = now + leaveDelay;
+        }
+        return;
+    }
+
+    if (eventDisconnected) {
+        eventDisconnected = false;
+        if (state == LINK_UP) {
+            disconnects++;
+            downSince = now;
+            Serial.println("WiFi: disconnected (reason " + String(lastDisconnectReason) + "), rejoining");
+            retryDelay = WIFI_RETRY_MIN;
+            startJoin();  // An AP reboot usually keeps BSSID and channel, so try the cache first
+        } else if (state == LINK_JOINING) {
+            joinFailed("refused");
+        }
+        return;
+    }
+
+    if (eventGotIp && state == LINK_JOINING) {
+        eventGotIp = false;
+        state = LINK_UP;
+        linkUp = true;
+        retryDelay = WIFI_RETRY_MIN;
+        lastJoinTime = now - joinStartedAt;
+        if (fastJoin) {
+            fastJoins++;
+        } else {
+            fullJoins++;
+            skipFastJoin = false;  // The cache is refreshed below
+        }
+        String line = "WiFi: up in " + String(lastJoinTime) + "ms (" + (fastJoin ? "fast" : "full") + " join)";
+        if (downSince != 0) {
+            lastOutage = now - downSince;
+            maxOutage = max(maxOutage, lastOutage);
+            line += ", back after " + String(lastOutage) + "ms offline";
+            downSince = 0;
+        }
+        Serial.println(line + ", IP " + WiFi.localIP().toString() + ", RSSI " + String(WiFi.RSSI()) + " dBm");
+        saveCache();
+        return;
+    }
+
+    if (state == LINK_JOINING &&
+        now - joinStartedAt >= (fastJoin ? WIFI_FAST_JOIN_TIMEOUT : WIFI_JOIN_TIMEOUT)) {
+        joinFailed("timed out");
+    } else if (state == LINK_WAITING && (long)(now - retryAt) >= 0) {
+        startJoin();
+    }
+}
+
+bool wifiLinkUp() {
+    return linkUp;
+}
+
+void wifiLinkPrintStats() {
+    const char *names[] = {"idle", "joining", "up", "leaving", "waiting to retry"};
+    Serial.println("WiFi: " + String(names[state]) + ", " + String(fastJoins) + " fast joins, " +
+                   String(fullJoins) + " full joins, " + String(joinFailures) + " failed attempts, " +
+                   String(disconnects) + " disconnects");
+    Serial.println("WiFi timing: last join " + String(lastJoinTime) + "ms, last outage " + String(lastOutage) +
+                   "ms, worst outage " + String(maxOutage) + "ms");
+    if (cacheValid) {
+        char bssid[18];
+        snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X", cache.bssid[0], cache.bssid[1],
+                 cache.bssid[2], cache.bssid[3], cache.bssid[4], cache.bssid[5]);
+        Serial.println("WiFi cache: " + String(bssid) + " channel " + String(cache.channel) + ", " +
+                       IPAddress(cache.ip).toString() + (WIFI_REUSE_LEASE ? " (reused)" : ""));
+    }
+}
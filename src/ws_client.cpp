@@ -0,0 +1,354 @@
+#include "ws_client.h"
+#include "dns_cache.h"
+#include "mbedtls/sha1.h"
+
+// Appended to the key before hashing, RFC 6455 section 1.3
+static const char WS_ACCEPT_GUID[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+// Base64 for the 16-byte Sec-WebSocket-Key and the 20-byte accept hash
+static String base64Encode(const uint8_t *data, size_t length) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    String out;
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t chunk = (uint32_t)data[i] << 16;
+        if (i + 1 < length) chunk |= (uint32_t)data[i + 1] << 8;
+        if (i + 2 < length) chunk |= data[i + 2];
+        out += alphabet[(chunk >> 18) & 0x3F];
+        out += alphabet[(chunk >> 12) & 0x3F];
+        out += i + 1 < length ? alphabet[(chunk >> 6) & 0x3F] : '=';
+        out += i + 2 < length ? alphabet[chunk & 0x3F] : '=';
+    }
+    return out;
+}
+
+WebSocketClient::WebSocketClient()
+    : port(0), path("/"), handler(NULL), context(NULL), state(IDLE), stateSince(0), lastActivity(0),
+      lastPing(0), retryAt(0), retryDelay(WS_RETRY_MIN), justConnected(false), statusCode(0), acceptValid(false),
+      frameState(FRAME_OPCODE), opcode(0), messageOpcode(0), fin(false), masked(false), lengthBytes(0),
+      maskBytes(0), payloadLength(0), payloadRead(0), dropMessage(false), messageCount(0), connectCount(0) {
+}
+
+void WebSocketClient::begin(const String &host, uint16_t port, const char *path, MessageHandler handler, void *context) {
+    this->host = host;
+    this->port = port;
+    this->path = path;
+    this->handler = handler;
+    this->context = context;
+    retryAt = millis();
+}
+
+void WebSocketClient::connect() {
+    IPAddress ip;
+    if (!dnsCacheResolve(host.c_str(), ip)) {
+        backoff();
+        return;
+    }
+    if (!client.connect(ip, port, WS_CONNECT_TIMEOUT)) {
+        Serial.println("WebSocket connect to " + host + " failed, retry in " + String(retryDelay / 1000) + "s");
+        backoff();
+        return;
+    }
+    client.setNoDelay(true);
+
+    uint8_t key[16];
+    for (int i = 0; i < 16; i += 4) {
+        uint32_t r = esp_random();
+        memcpy(key + i, &r, 4);
+    }
+    String keyText = base64Encode(key, sizeof(key));
+    // The server proves it speaks WebSocket by answering with base64(SHA-1(key + GUID))
+    String acceptInput = keyText + WS_ACCEPT_GUID;
+    uint8_t digest[20];
+    mbedtls_sha1((const unsigned char *)acceptInput.c_str(), acceptInput.length(), digest);
+    expectedAccept = base64Encode(digest, sizeof(digest));
+    client.print(String("GET ") + path + " HTTP/1.1\r\n" +
+                 "Host: " + host + ":" + String(port) + "\r\n" +
+                 "Upgrade: websocket\r\n" +
+                 "Connection: Upgrade\r\n" +
+                 "Sec-WebSocket-Key: " + keyText + "\r\n" +
+                 "Sec-WebSocket-Version: 13\r\n\r\n");
+
+    state = HANDSHAKE;
+    stateSince = millis();
+    lastActivity = stateSince;
+    lastPing = stateSince;
+    line = "";
+    statusCode = 0;
+    acceptValid = false;
+    frameState = FRAME_OPCODE;
+    message = "";
+    dropMessage = false;
+}
+
+// Close the socket and schedule the next attempt
+void WebSocketClient::fail(unsigned long delayMs) {
+    client.stop();
+    state = IDLE;
+    stateSince = millis();
+    retryAt = stateSince + delayMs;
+}
+
+void WebSocketClient::backoff() {
+    fail(retryDelay);
+    retryDelay = retryDelay * 2 > WS_RETRY_MAX ? WS_RETRY_MAX : retryDelay * 2;
+}
+
+void WebSocketClient::stop() {
+    if (state == OPEN) {
+        sendFrame(0x8, NULL, 0);
+    }
+    fail(WS_RETRY_MIN);
+}
+
+void WebSocketClient::poll() {
+    if (host.length() == 0) {
+        return;
+    }
+    if (state == IDLE) {
+        if ((long)(millis() - retryAt) >= 0) {
+            connect();
+        }
+        return;
+    }
+
+    // Bounded per call so a burst of messages cannot starve the worker's request queue
+    int budget = 1024;
+    while (budget-- > 0 && state != IDLE && client.available() > 0) {
+        int c = client.read();
+        if (c < 0) {
+            break;
+        }
+        lastActivity = millis();
+        if (state == HANDSHAKE) {
+            receiveHandshake((char)c);
+        } else {
+            receiveFrame((uint8_t)c);
+        }
+    }
+    if (state == IDLE) {
+        return;
+    }
+
+    unsigned long now = millis();
+    if (!client.connected() && client.available() == 0) {
+        Serial.println("WebSocket to " + host + " closed");
+        backoff();
+    } else if (state == HANDSHAKE && now - stateSince >= WS_HANDSHAKE_TIMEOUT) {
+        Serial.println("WebSocket to " + host + ": no upgrade response");
+        backoff();
+    } else if (state == OPEN) {
+        if (now - lastActivity >= WS_STALE_TIMEOUT) {
+            Serial.println("WebSocket to " + host + " stale, reconnecting");
+            backoff();
+        } else if (now - lastActivity >= WS_PING_INTERVAL && now - lastPing >= WS_PING_INTERVAL) {
+            sendFrame(0x9, NULL, 0);
+            lastPing = now;
+        }
+    }
+}
+
+bool WebSocketClient::connected() const {
+    return state == OPEN;
+}
+
+bool WebSocketClient::takeConnected() {
+    bool value = justConnected;
+    justConnected = false;
+    return value;
+}
+
+void WebSocketClient::receiveHandshake(char c) {
+    if (c != '\n') {
+        if (c != '\r' && line.length() < 256) {
+            line += c;
+        }
+        return;
+    }
+
+    if (statusCode == 0) {
+        // "HTTP/1.1 101 Switching Protocols"
+        int space = line.indexOf(' ');
+        statusCode = space > 0 ? line.substring(space + 1).toInt() : -1;
+    } else if (line.length() > 0) {
+        int colon = line.indexOf(':');
+        if (colon > 0 && line.substring(0, colon).equalsIgnoreCase("Sec-WebSocket-Accept")) {
+            String value = line.substring(colon + 1);
+            value.trim();
+            acceptValid = value == expectedAccept;
+        }
+    } else {
+        // Blank line: end of the upgrade response, frames follow
+        if (statusCode == 101 && !acceptValid) {
+            Serial.println("WebSocket upgrade to " + host + " rejected: bad Sec-WebSocket-Accept");
+            backoff();
+        } else if (statusCode == 101) {
+            state = OPEN;
+            stateSince = millis();
+            retryDelay = WS_RETRY_MIN;
+            justConnected = true;
+            connectCount++;
+            Serial.println("WebSocket connected to " + host + path);
+        } else {
+            Serial.println("WebSocket upgrade to " + host + " rejected with code: " + String(statusCode));
+            backoff();
+        }
+    }
+    line = "";
+}
+
+void WebSocketClient::receiveFrame(uint8_t b) {
+    switch (frameState) {
+        case FRAME_OPCODE:
+            fin = (b & 0x80) != 0;
+            opcode = b & 0x0F;
+            frameState = FRAME_LENGTH;
+            break;
+        case FRAME_LENGTH:
+            masked = (b & 0x80) != 0;
+            payloadLength = b & 0x7F;
+            if (payloadLength >= 126) {
+                lengthBytes = payloadLength == 126 ? 2 : 8;
+                payloadLength = 0;
+                frameState = FRAME_EXTENDED_LENGTH;
+            } else if (masked) {
+                maskBytes = 4;
+                frameState = FRAME_MASK;
+            } else {
+                startPayload();
+            }
+            break;
+        case FRAME_EXTENDED_LENGTH:
+            payloadLength = (payloadLength << 8) | b;
+            if (--lengthBytes == 0) {
+                if (masked) {
+                    maskBytes = 4;
+                    frameState = FRAME_MASK;
+                } else {
+                    startPayload();
+                }
+            }
+            break;
+        case FRAME_MASK:
+            maskKey[4 - maskBytes] = b;
+            if (--maskBytes == 0) {
+                startPayload();
+            }
+            break;
+        case FRAME_PAYLOAD:
+            if (masked) {
+                b ^= maskKey[payloadRead % 4];
+            }
+            if (opcode & 0x08) {
+                if (control.length() < 125) {
+                    control += (char)b;
+                }
+            } else if (!dropMessage && messageOpcode == 0x1) {
+                message += (char)b;
+            }
+            if (++payloadRead == payloadLength) {
+                finishFrame();
+            }
+            break;
+    }
+}
+
+void WebSocketClient::startPayload() {
+    payloadRead = 0;
+    control = "";
+    if (opcode == 0x1 || opcode == 0x2) {
+        // First frame of a new message
+        messageOpcode = opcode;
+        message = "";
+        dropMessage = false;
+    }
+    if (!(opcode & 0x08) && message.length() + payloadLength > WS_MAX_MESSAGE) {
+        dropMessage = true;
+        message = "";
+    }
+    if (payloadLength == 0) {
+        finishFrame();
+    } else {
+        frameState = FRAME_PAYLOAD;
+    }
+}
+
+void WebSocketClient::finishFrame() {
+    frameState = FRAME_OPCODE;
+    switch (opcode) {
+        case 0x8:  // Close: echo it and reconnect later
+            Serial.println("WebSocket to " + host + " closed by server");
+            sendFrame(0x8, (const uint8_t *)control.c_str(), control.length() >= 2 ? 2 : 0);
+            backoff();
+            break;
+        case 0x9:  // Ping
+            sendFrame(0xA, (const uint8_t *)control.c_str(), control.length());
+            break;
+        case 0xA:  // Pong
+            break;
+        default:   // Text, binary or continuation
+            if (!fin) {
+                break;
+            }
+            if (dropMessage) {
+                Serial.println("WebSocket to " + host + ": dropped oversized message");
+            } else if (messageOpcode == 0x1) {
+                messageCount++;
+                handler(context, message);
+            }
+            message = "";
+            dropMessage = false;
+            break;
+    }
+}
+
+bool WebSocketClient::sendFrame(uint8_t frameOpcode, const uint8_t *payload, size_t length) {
+    // Client frames are always masked
+    uint8_t header[14];
+    size_t headerLength = 0;
+    header[headerLength++] = 0x80 | frameOpcode;
+    if (length < 126) {
+        header[headerLength++] = 0x80 | length;
+    } else if (length <= 0xFFFF) {
+        header[headerLength++] = 0x80 | 126;
+        header[headerLength++] = (length >> 8) & 0xFF;
+        header[headerLength++] = length & 0xFF;
+    } else {
+        header[headerLength++] = 0x80 | 127;
+        for (int i = 7; i >= 0; i--) {
+            header[headerLength++] = i >= 4 ? 0 : (length >> (i * 8)) & 0xFF;
+        }
+    }
+    uint32_t r = esp_random();
+    uint8_t mask[4];
+    memcpy(mask, &r, 4);
+    memcpy(header + headerLength, mask, 4);
+    headerLength += 4;
+    if (client.write(header, headerLength) != headerLength) {
+        return false;
+    }
+
+    uint8_t buffer[64];
+    for (size_t offset = 0; offset < length; offset += sizeof(buffer)) {
+        size_t n = length - offset < sizeof(buffer) ? length - offset : sizeof(buffer);
+        for (size_t i = 0; i < n; i++) {
+            buffer[i] = payload[offset + i] ^ mask[(offset + i) % 4];
+        }
+        if (client.write(buffer, n) != n) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WebSocketClient::sendText(const String &text) {
+    if (state != OPEN) {
+        return false;
+    }
+    return sendFrame(0x1, (const uint8_t *)text.c_str(), text.length());
+}
+
+void WebSocketClient::printStats(const String &label) const {
+    const char *stateName = state == OPEN ? "open" : state == HANDSHAKE ? "connecting" : "idle";
+    Serial.println("WebSocket " + label + ": " + String(stateName) + ", " + String(messageCount) + " messages, " +
+                   String(connectCount) + " connects");
+}
@@ -0,0 +1,94 @@
+// Host tests for civil_time: US Eastern DST transitions for 2000-2099, day
+// numbers and weekdays. Run with: pio test -e native
+
+#include <unity.h>
+#include "civil_time.h"
+
+static const char *ZONE = "EST5EDT,M3.2.0,M11.1.0";
+static const long EST = -5 * 3600L;
+static const long EDT = -4 * 3600L;
+
+// Day number of the nth Sunday of month in year (1970-01-01 was a Thursday)
+static long nthSunday(int year, int month, int n) {
+    long first = civilDayNumber(year, month, 1);
+    long weekday = ((first + 4) % 7 + 7) % 7;
+    return first + (7 - weekday) % 7 + (n - 1) * 7;
+}
+
+static void assertLocal(time_t utc, int hour, int minute, bool dst, long offset) {
+    CivilTime local = civilTimeFromUtc(utc);
+    TEST_ASSERT_EQUAL_INT(hour, local.hour);
+    TEST_ASSERT_EQUAL_INT(minute, local.minute);
+    TEST_ASSERT_EQUAL(dst, local.dst);
+    TEST_ASSERT_EQUAL_INT32(offset, local.utcOffset);
+}
+
+void setUp() {
+    civilTimeBegin(ZONE);
+}
+
+void tearDown() {
+}
+
+void test_day_number_anchors() {
+    TEST_ASSERT_EQUAL_INT32(0, civilDayNumber(1970, 1, 1));
+    TEST_ASSERT_EQUAL_INT32(-1, civilDayNumber(1969, 12, 31));
+    TEST_ASSERT_EQUAL_INT32(10957, civilDayNumber(2000, 1, 1));
+    TEST_ASSERT_EQUAL_INT32(60, civilDayNumber(2000, 3, 1) - civilDayNumber(2000, 1, 1));    // 2000 is a leap year
+    TEST_ASSERT_EQUAL_INT32(1, civilDayNumber(2100, 3, 1) - civilDayNumber(2100, 2, 28));    // 2100 is not
+    TEST_ASSERT_EQUAL_INT32(36525, civilDayNumber(2100, 1, 1) - civilDayNumber(2000, 1, 1));
+}
+
+// Every day of the century: the date and weekday at local noon match the day number
+void test_dates_and_weekdays_2000_2099() {
+    static const int DAYS_IN_MONTH[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    long day = civilDayNumber(2000, 1, 1);
+    int weekday = 6;  // 2000-01-01 was a Saturday
+    for (int year = 2000; year < 2100; year++) {
+        bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+        for (int month = 1; month <= 12; month++) {
+            int days = DAYS_IN_MONTH[month - 1] + (month == 2 && leap ? 1 : 0);
+            for (int d = 1; d <= days; d++) {
+                TEST_ASSERT_EQUAL_INT32(day, civilDayNumber(year, month, d));
+                CivilTime local = civilTimeFromUtc((time_t)day * 86400 + 17 * 3600);
+                TEST_ASSERT_EQUAL_INT(year, local.year);
+                TEST_ASSERT_EQUAL_INT(month, local.month);
+                TEST_ASSERT_EQUAL_INT(d, local.day);
+                TEST_ASSERT_EQUAL_INT(weekday, local.weekday);
+                day++;
+                weekday = (weekday + 1) % 7;
+            }
+        }
+    }
+}
+
+// Second Sunday in March: 01:59:59 EST is followed by 03:00:00 EDT (07:00 UTC)
+void test_spring_forward_2000_2099() {
+    for (int year = 2000; year < 2100; year++) {
+        time_t change = (time_t)nthSunday(year, 3, 2) * 86400 + 7 * 3600;
+        assertLocal(change - 1, 1, 59, false, EST);
+        assertLocal(change, 3, 0, true, EDT);
+        TEST_ASSERT_EQUAL_STRING("EDT", civilZoneName(civilTimeFromUtc(change)));
+    }
+}
+
+// First Sunday in November: 01:59:59 EDT is followed by 01:00:00 EST (06:00 UTC)
+void test_fall_back_2000_2099() {
+    for (int year = 2000; year < 2100; year++) {
+        time_t change = (time_t)nthSunday(year, 11, 1) * 86400 + 6 * 3600;
+        assertLocal(change - 1, 1, 59, true, EDT);
+        assertLocal(change, 1, 0, false, EST);
+        TEST_ASSERT_EQUAL_STRING("EST", civilZoneName(civilTimeFromUtc(change)));
+    }
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_day_number_anchors);
+    RUN_TEST(test_dates_and_weekdays_2000_2099);
+    RUN_TEST(test_spring_forward_2000_2099);
+    RUN_TEST(test_fall_back_2000_2099);
+    return UNITY_END();
+}
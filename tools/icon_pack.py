@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""Generate src/icon_pack_data.h, the icon set drawn by src/icon_pack.cpp.
+
+Icons are drawn here with the same circle, line and rectangle algorithms as
+TFT_eSPI, then stored palette-indexed and run-length encoded: each byte is
+(palette index << 4) | (run length - 1), rows running on into each other.
+Palette entries 0 and 1 are the background and tint passed at draw time.
+
+Icons must stay in the order of IconId in include/icon_pack.h.
+
+Usage: python3 tools/icon_pack.py > src/icon_pack_data.h
+"""
+
+BACKGROUND, TINT, YELLOW, LIGHTGREY, GREY, BLUE, DARKGREY, WHITE = range(8)
+PALETTE = [0x0000, 0xFFFF, 0xFFE0, 0xC618, 0x7BEF, 0x001F, 0x39E7, 0xFFFF]
+
+
+class Icon:
+    def __init__(self, name, width, height):
+        self.name = name
+        self.width = width
+        self.height = height
+        self.pixels = [[BACKGROUND] * width for _ in range(height)]
+
+    def pixel(self, x, y, color):
+        if 0 <= x < self.width and 0 <= y < self.height:
+            self.pixels[y][x] = color
+
+    def hline(self, x, y, w, color):
+        for i in range(w):
+            self.pixel(x + i, y, color)
+
+    def rect(self, x, y, w, h, color):
+        for j in range(h):
+            self.hline(x, y + j, w, color)
+
+    def fill_circle(self, x0, y0, r, color):
+        # TFT_eSPI::fillCircle()
+        self.hline(x0 - r, y0, 2 * r + 1, color)
+        x, dx, dy, p = 0, 1, r + r, -(r >> 1)
+        while x < r:
+            if p >= 0:
+                self.hline(x0 - x, y0 + r, 2 * x + 1, color)
+                self.hline(x0 - x, y0 - r, 2 * x + 1, color)
+                dy -= 2
+                p -= dy
+                r -= 1
+            dx += 2
+            p += dx
+            x += 1
+            self.hline(x0 - r, y0 + x, 2 * r + 1, color)
+            self.hline(x0 - r, y0 - x, 2 * r + 1, color)
+
+    def circle(self, x0, y0, r, color):
+        # TFT_eSPI::drawCircle()
+        x, dx, dy, p = 1, 1, r + r, -(r >> 1)
+        for px, py in ((x0 + r, y0), (x0 - r, y0), (x0, y0 - r), (x0, y0 + r)):
+            self.pixel(px, py, color)
+        while x < r:
+            if p >= 0:
+                dy -= 2
+                p -= dy
+                r -= 1
+            dx += 2
+            p += dx
+            for sx in (1, -1):
+                for sy in (1, -1):
+                    self.pixel(x0 + sx * x, y0 + sy * r, color)
+                    if r != x:
+                        self.pixel(x0 + sx * r, y0 + sy * x, color)
+            x += 1
+
+    def line(self, x0, y0, x1, y1, color):
+        dx, dy = abs(x1 - x0), -abs(y1 - y0)
+        sx, sy = (1 if x0 < x1 else -1), (1 if y0 < y1 else -1)
+        err = dx + dy
+        while True:
+            self.pixel(x0, y0, color)
+            if x0 == x1 and y0 == y1:
+                return
+            e2 = 2 * err
+            if e2 >= dy:
+                err += dy
+                x0 += sx
+            if e2 <= dx:
+                err += dx
+                y0 += sy
+
+    def encode(self):
+        flat = [c for row in self.pixels for c in row]
+        out = []
+        i = 0
+        while i < len(flat):
+            run = 1
+            while run < 16 and i + run < len(flat) and flat[i + run] == flat[i]:
+                run += 1
+            out.append((flat[i] << 4) | (run - 1))
+            i += run
+        return out
+
+
+def cloud(icon, x, y, color):
+    icon.fill_circle(x + 11, y + 8, 9, color)
+    icon.fill_circle(x + 4, y + 13, 6, color)
+    icon.fill_circle(x + 21, y + 12, 7, color)
+    icon.rect(x + 4, y + 13, 18, 7, color)
+
+
+def moon(icon, x0, y0, r):
+    icon.fill_circle(x0, y0, r, YELLOW)
+    icon.fill_circle(x0 + r // 2, y0 - r // 2, r * 3 // 4, BACKGROUND)
+
+
+def weather_icons():
+    icons = []
+
+    icon = Icon("clear day", 50, 50)
+    icon.fill_circle(25, 25, 20, YELLOW)
+    icons.append(icon)
+
+    icon = Icon("clear night", 50, 50)
+    moon(icon, 25, 25, 19)
+    icons.append(icon)
+
+    icon = Icon("few clouds, day", 50, 50)
+    icon.fill_circle(31, 17, 12, YELLOW)
+    cloud(icon, 8, 20, LIGHTGREY)
+    icon.fill_circle(22, 30, 15, LIGHTGREY)
+    icons.append(icon)
+
+    icon = Icon("few clouds, night", 50, 50)
+    moon(icon, 31, 17, 14)
+    cloud(icon, 8, 20, LIGHTGREY)
+    icon.fill_circle(22, 30, 15, LIGHTGREY)
+    icons.append(icon)
+
+    # Scattered or broken clouds, rain, thunderstorm, snow and mist look the
+    # same by day and night
+    icon = Icon("clouds", 50, 50)
+    icon.fill_circle(25, 25, 20, GREY)
+    icon.fill_circle(15, 25, 15, GREY)
+    icons.append(icon)
+
+    icon = Icon("rain", 50, 50)
+    icon.fill_circle(25, 20, 15, BLUE)
+    for i in range(3):
+        icon.line(20 + i * 5, 30, 15 + i * 5, 40, BLUE)
+    icons.append(icon)
+
+    icon = Icon("thunderstorm", 50, 50)
+    icon.fill_circle(25, 20, 15, DARKGREY)
+    icon.line(20, 30, 30, 40, YELLOW)
+    icon.line(30, 40, 20, 50, YELLOW)
+    icons.append(icon)
+
+    icon = Icon("snow", 50, 50)
+    icon.fill_circle(25, 20, 15, WHITE)
+    for i in range(3):
+        icon.line(20 + i * 5, 30, 15 + i * 5, 40, WHITE)
+    icons.append(icon)
+
+    icon = Icon("mist", 50, 50)
+    icon.rect(10, 20, 30, 10, LIGHTGREY)
+    icon.rect(10, 35, 30, 10, LIGHTGREY)
+    icons.append(icon)
+    return icons
+
+
+def status_icons():
+    icons = []
+
+    # Status dots sized for a font 2 line, drawn in the line's colour
+    icon = Icon("status: full", 11, 11)
+    icon.fill_circle(5, 5, 5, TINT)
+    icons.append(icon)
+
+    icon = Icon("status: half", 11, 11)
+    icon.fill_circle(5, 5, 5, TINT)
+    icon.rect(6, 0, 5, 11, BACKGROUND)
+    icon.circle(5, 5, 5, TINT)
+    icons.append(icon)
+
+    icon = Icon("status: empty", 11, 11)
+    icon.circle(5, 5, 5, TINT)
+    icons.append(icon)
+
+    icon = Icon("printer", 14, 14)
+    icon.fill_circle(7, 7, 6, TINT)
+    icon.circle(7, 7, 6, WHITE)
+    icons.append(icon)
+    return icons
+
+
+def main():
+    icons = weather_icons() + status_icons()
+    data = []
+    index = []
+    for icon in icons:
+        index.append((icon.width, icon.height, len(data), icon.name))
+        data.extend(icon.encode())
+
+    print("// Generated by tools/icon_pack.py; edit the shapes there and regenerate.")
+    print()
+    print("const uint16_t ICON_PACK_PALETTE[] = {")
+    print("    " + ", ".join("0x%04X" % c for c in PALETTE) + ",")
+    print("};")
+    print()
+    print("const IconPackEntry ICON_PACK_INDEX[] = {")
+    for width, height, offset, name in index:
+        print("    %-16s// %s" % ("{%d, %d, %d}," % (width, height, offset), name))
+    print("};")
+    print()
+    print("const uint8_t ICON_PACK_DATA[] PROGMEM = {   // %d bytes" % len(data))
+    for i in range(0, len(data), 16):
+        print("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()